@@ -0,0 +1,218 @@
+/**
+ * @file latency_bench.cpp
+ * @brief Микробенчмарк задержки решения одного уравнения.
+ *
+ * @details
+ * Сравнивает распределение задержки @ref solve_square_equation и
+ * @ref solve_square_equation_branchless на случайной смеси уравнений всех видов
+ * (линейные, без корней, с одним и двумя корнями), где переходы плохо предсказываются.
+ * Вызовы зависимы: следующий вызов получает коэффициент, зависящий от типа результата
+ * предыдущего, поэтому измеряется задержка, а не пропускная способность.
+ *
+ * На x86 каждый замер - это один вызов между чтениями счетчика тактов rdtsc/rdtscp,
+ * окруженными инструкциями lfence, чтобы вызов не выполнялся вне замера. Из замера
+ * вычитаются накладные расходы пустого замера, такты переводятся в нс по частоте счетчика,
+ * измеренной за время прогона. Печатаются p50, p99 и p99.9 задержки одного вызова в нс.
+ *
+ * На других архитектурах точного счетчика нет, поэтому замер - это среднее по SAMPLE_CALLS
+ * последовательным вызовам, измеренное std::chrono::steady_clock, и печатаются
+ * перцентили этого среднего (хвосты отдельных вызовов в нем сглаживаются).
+ * Набор уравнений выбран достаточно большим, чтобы предсказатель переходов не запомнил
+ * последовательность их видов.
+ *
+ * Сборка из корня репозитория:
+ * `g++ -std=c++17 -O2 -I include bench/latency_bench.cpp source/solver.cpp source/int_solver.cpp
+ * source/comparison_with_zero.cpp -o latency_bench`
+ *
+ * Запуск: `./latency_bench [количество замеров]`
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <chrono>
+#include <vector>
+#include <random>
+#include <algorithm>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define LATENCY_BENCH_RDTSC 1
+#endif
+#include "solver.h"
+
+/**
+ * @brief Количество зависимых вызовов в одном замере без счетчика тактов.
+ */
+const size_t SAMPLE_CALLS = 16;
+
+/**
+ * @brief Количество различных уравнений, по которым циклически проходят замеры.
+ */
+const size_t NUM_EQUATIONS = 65536;
+
+/**
+ * @brief Создает случайную смесь уравнений всех видов.
+ *
+ * @param[in] count Количество уравнений.
+ * @return Массив коэффициентов.
+ */
+static std::vector<SquareEquationCoefficient> make_equations(size_t count) {
+    std::mt19937_64 random(20261018);
+    std::uniform_int_distribution<int> kind(0, 4);
+    std::uniform_real_distribution<double> value(-100, 100);
+
+    std::vector<SquareEquationCoefficient> coeffts(count);
+    for (SquareEquationCoefficient& equation : coeffts) {
+        double root = value(random);
+        switch (kind(random)) {
+            case 0:  equation = { 0, value(random), value(random) };            break;
+            case 1:  equation = { 1, 0, 1 + fabs(value(random)) };              break;
+            case 2:  equation = { 1, -2 * root, root * root };                  break;
+            case 3:  equation = { value(random), 0, 0 };                        break;
+            default: equation = { 1, value(random), -fabs(value(random)) - 1 }; break;
+        }
+    }
+    return coeffts;
+}
+
+/**
+ * @brief Возвращает тип результата решения.
+ *
+ * @details
+ * Зависимость между вызовами строится через тип результата, а не через корни, так как
+ * @ref solve_square_equation не заполняет отсутствующие корни.
+ */
+template <typename Result>
+static int result_type(const Result& result) {
+    return result.result_type;
+}
+
+#ifdef LATENCY_BENCH_RDTSC
+/**
+ * @brief Читает счетчик тактов в начале замера.
+ *
+ * @details
+ * Первый lfence дожидается завершения предыдущих инструкций, второй не дает
+ * инструкциям замера начаться до чтения счетчика.
+ *
+ * @return Значение счетчика тактов.
+ */
+static inline uint64_t start_ticks() {
+    _mm_lfence();
+    uint64_t ticks = __rdtsc();
+    _mm_lfence();
+    return ticks;
+}
+
+/**
+ * @brief Читает счетчик тактов в конце замера.
+ *
+ * @details
+ * rdtscp читает счетчик после завершения всех предыдущих инструкций, lfence не дает
+ * последующим инструкциям начаться до чтения счетчика.
+ *
+ * @return Значение счетчика тактов.
+ */
+static inline uint64_t finish_ticks() {
+    unsigned processor = 0;
+    uint64_t ticks = __rdtscp(&processor);
+    _mm_lfence();
+    return ticks;
+}
+
+/**
+ * @brief Измеряет накладные расходы пустого замера.
+ *
+ * @return Наименьшее количество тактов между @ref start_ticks и @ref finish_ticks.
+ */
+static uint64_t measure_overhead() {
+    uint64_t overhead = UINT64_MAX;
+    for (int i = 0; i < 100000; ++i) {
+        uint64_t start = start_ticks();
+        uint64_t finish = finish_ticks();
+        overhead = std::min(overhead, finish - start);
+    }
+    return overhead;
+}
+#endif
+
+/**
+ * @brief Измеряет задержку одного вызова функции решения.
+ *
+ * @param[in] name        Название функции для вывода.
+ * @param[in] solve       Функция решения.
+ * @param[in] coeffts     Уравнения для замеров.
+ * @param[in] num_samples Количество замеров.
+ */
+template <typename Result>
+static void measure(const char* name, Result (*solve)(SquareEquationCoefficient),
+                    const std::vector<SquareEquationCoefficient>& coeffts, size_t num_samples) {
+    std::vector<double> latencies(num_samples);
+    double chain = 0;
+    size_t next = 0;
+
+#ifdef LATENCY_BENCH_RDTSC
+    uint64_t overhead = measure_overhead();
+    auto run_start = std::chrono::steady_clock::now();
+    uint64_t run_start_ticks = start_ticks();
+
+    for (size_t sample = 0; sample < num_samples; ++sample) {
+        SquareEquationCoefficient equation = coeffts[next];
+        equation.c += chain;
+        next = (next + 1) % coeffts.size();
+
+        uint64_t start = start_ticks();
+        Result result = solve(equation);
+        uint64_t finish = finish_ticks();
+
+        chain = result_type(result) * 0.0;
+        uint64_t ticks = finish - start;
+        latencies[sample] = (double) (ticks > overhead ? ticks - overhead : 0);
+    }
+
+    uint64_t run_ticks = finish_ticks() - run_start_ticks;
+    double run_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - run_start).count();
+    for (double& latency : latencies) {
+        latency *= run_ns / (double) run_ticks;
+    }
+    char kind[32] = "one call";
+#else
+    for (size_t sample = 0; sample < num_samples; ++sample) {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < SAMPLE_CALLS; ++i) {
+            SquareEquationCoefficient equation = coeffts[next];
+            equation.c += chain;
+            chain = result_type(solve(equation)) * 0.0;
+            next = (next + 1) % coeffts.size();
+        }
+        auto finish = std::chrono::steady_clock::now();
+        latencies[sample] = std::chrono::duration<double, std::nano>(finish - start).count() / SAMPLE_CALLS;
+    }
+    char kind[32] = "";
+    snprintf(kind, sizeof(kind), "mean of %zu calls", SAMPLE_CALLS);
+#endif
+
+    std::sort(latencies.begin(), latencies.end());
+    printf("%-34s (%s) p50 %6.2f ns  p99 %6.2f ns  p99.9 %6.2f ns\n", name, kind,
+           latencies[num_samples / 2],
+           latencies[num_samples * 99 / 100],
+           latencies[num_samples * 999 / 1000]);
+}
+
+int main(int argc, char* argv[]) {
+    size_t num_samples = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    if (num_samples < 1000) {
+        num_samples = 1000;
+    }
+
+    std::vector<SquareEquationCoefficient> coeffts = make_equations(NUM_EQUATIONS);
+
+    for (int round = 0; round < 2; ++round) {
+        measure("solve_square_equation", solve_square_equation, coeffts, num_samples);
+        measure("solve_square_equation_branchless", solve_square_equation_branchless, coeffts, num_samples);
+    }
+    return 0;
+}
@@ -0,0 +1,66 @@
+#!/bin/sh
+# Measures how many solver invocations per second a script can make and compares
+# them with a baseline binary (for example one built from the previous release).
+#
+# The baseline has only the interactive menu, so it is measured in menu mode; the new
+# binary is measured both in menu mode and in the one-shot argv mode. The modes are run
+# in alternating rounds and the best round of each is reported, so that background load
+# affects all of them alike.
+#
+# Usage: bench/startup_bench.sh path/to/solver path/to/baseline_solver [invocations] [rounds]
+
+SOLVER=$1
+BASELINE=$2
+COUNT=${3:-1000}
+ROUNDS=${4:-5}
+
+for binary in "$SOLVER" "$BASELINE"; do
+    if [ -z "$binary" ] || [ ! -x "$binary" ]; then
+        echo "usage: $0 path/to/solver path/to/baseline_solver [invocations] [rounds]" >&2
+        exit 1
+    fi
+done
+
+now_ns() {
+    date +%s%N
+}
+
+# Prints the elapsed time in nanoseconds of COUNT invocations of the given mode.
+run_mode() {
+    start=$(now_ns)
+    i=0
+    while [ $i -lt "$COUNT" ]; do
+        case $1 in
+            argv) "$SOLVER" 1 -3 2 > /dev/null ;;
+            menu) printf '2\n1\n-3\n2\n' | "$SOLVER" > /dev/null ;;
+            base) printf '2\n1\n-3\n2\n' | "$BASELINE" > /dev/null ;;
+        esac
+        i=$(( i + 1 ))
+    done
+    echo $(( $(now_ns) - start ))
+}
+
+best_base=0
+best_menu=0
+best_argv=0
+round=0
+while [ $round -lt "$ROUNDS" ]; do
+    for mode in base menu argv; do
+        elapsed=$(run_mode $mode)
+        eval "best=\$best_$mode"
+        if [ "$best" -eq 0 ] || [ "$elapsed" -lt "$best" ]; then
+            eval "best_$mode=$elapsed"
+        fi
+    done
+    round=$(( round + 1 ))
+done
+
+report() {
+    echo "$1: $(( COUNT * 1000000000 / $2 )) invocations/s" \
+         "($(( $2 / COUNT / 1000 )) us each, $(( $2 * 100 / best_base ))% of baseline time)"
+}
+
+echo "$COUNT invocations, best of $ROUNDS rounds"
+report "baseline, interactive menu" "$best_base"
+report "solver, interactive menu  " "$best_menu"
+report "solver, argv one-shot     " "$best_argv"
@@ -0,0 +1,108 @@
+/**
+ * @file batch_solver.h
+ * @brief Заголовочный файл пакетного решения уравнений из текстовых данных.
+ *
+ * @details
+ * Этот файл содержит объявления функций для неинтерактивного решения большого числа уравнений:
+ * строки с коэффициентами `a b c` разбираются, решаются пакетами с помощью
+ * @ref solve_square_equations и форматируются в выходной буфер или файл. Если в параметрах задана
+ * статистика исключения повторов, пакеты решаются @ref solve_square_equations_dedup.
+ * Если заданы параметры упакованного формата, каждый пакет кодируется одним блоком
+ * @ref encode_packed_block, а тег записей не используется.
+ *
+ * Основные функции:
+ * - @ref solve_lines: решает все полные строки буфера в памяти.
+ * - @ref solve_stream: решает все строки входного файла и пишет результаты в выходной файл.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+#ifndef BATCH_SOLVER_H
+#define BATCH_SOLVER_H
+#include <stdio.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "record_io.h"
+#include "dedup_solver.h"
+#include "packed_results.h"
+
+/**
+ * @brief Максимальное количество уравнений, решаемых одним пакетом.
+ */
+const size_t BATCH_SIZE = 1024;
+
+/**
+ * @struct BatchOptions
+ * @brief Структура для хранения параметров пакетного решения.
+ */
+struct BatchOptions {
+    RecordFormat format;          /**< Формат записей результата. */
+    const char* tag;              /**< Префикс каждой записи (например, имя входного файла) или NULL. */
+    DedupStats* dedup_stats;      /**< Статистика исключения повторов или NULL, если повторы не исключаются. */
+    const PackedEncoding* packed; /**< Параметры упакованного двоичного формата или NULL для записей format. */
+};
+
+/**
+ * @struct OutputBuffer
+ * @brief Структура для хранения расширяемого буфера выходных данных.
+ *
+ * @details
+ * Нулевая структура является пустым буфером. Память освобождается @ref free_output.
+ */
+struct OutputBuffer {
+    char* data;      /**< Данные буфера. */
+    size_t size;     /**< Количество записанных байт. */
+    size_t capacity; /**< Размер выделенной памяти. */
+};
+
+/**
+ * @brief Дописывает данные в выходной буфер, при необходимости расширяя его.
+ *
+ * @param[in,out] output Выходной буфер.
+ * @param[in]     data   Данные для записи.
+ * @param[in]     size   Количество байт.
+ * @return SUCCESS при успехе, ERROR_CODE при нехватке памяти.
+ */
+int append_output(OutputBuffer* output, const char* data, size_t size);
+
+/**
+ * @brief Освобождает память выходного буфера.
+ *
+ * @param[in,out] output Выходной буфер.
+ */
+void free_output(OutputBuffer* output);
+
+/**
+ * @brief Решает все полные строки буфера и дописывает результаты в выходной буфер.
+ *
+ * @details
+ * Строки разделяются символом '\n', завершающий '\r' игнорируется, пустые строки пропускаются,
+ * некорректные строки пропускаются с сообщением в stderr. Если is_final равно false,
+ * последняя строка без перевода строки не обрабатывается.
+ *
+ * @param[in]     data     Входные данные.
+ * @param[in]     size     Размер входных данных.
+ * @param[in]     is_final Являются ли данные последними, то есть нужно ли обработать неполную строку.
+ * @param[in]     options  Параметры пакетного решения.
+ * @param[in,out] output   Выходной буфер.
+ * @param[out]    consumed Количество обработанных байт входных данных.
+ * @return SUCCESS при успехе, ERROR_CODE, если результаты не удалось записать в выходной буфер.
+ */
+int solve_lines(const char* data, size_t size, bool is_final, const BatchOptions* options,
+                OutputBuffer* output, size_t* consumed);
+
+/**
+ * @brief Решает все уравнения входного файла и записывает результаты в выходной файл.
+ *
+ * @details
+ * Для формата RECORD_CSV перед результатами записывается заголовок CSV_HEADER,
+ * для упакованного формата - заголовок упакованного файла.
+ *
+ * @param[in] input   Входной файл.
+ * @param[in] output  Выходной файл.
+ * @param[in] options Параметры пакетного решения.
+ * @return SUCCESS при успехе, иначе ERROR_CODE.
+ */
+int solve_stream(FILE* input, FILE* output, const BatchOptions* options);
+
+#endif // BATCH_SOLVER_H
@@ -0,0 +1,48 @@
+/**
+ * @file branchless_select.h
+ * @brief Заголовочный файл функций выбора значений без условных переходов.
+ *
+ * @details
+ * Этот файл содержит встраиваемые функции, которые заменяют ветвления битовыми масками.
+ * Они используются в решателях, где исход сравнений плохо предсказывается, и в циклах,
+ * которые должны векторизоваться компилятором.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+#ifndef BRANCHLESS_SELECT_H
+#define BRANCHLESS_SELECT_H
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief Возвращает маску из всех единиц, если условие истинно, иначе 0.
+ *
+ * @param[in] condition Условие (0 или 1).
+ * @return Маска условия.
+ */
+static inline uint64_t make_mask(uint64_t condition) {
+    return 0 - condition;
+}
+
+/**
+ * @brief Выбирает одно из двух чисел по маске без условного перехода.
+ *
+ * @param[in] mask     Маска из make_mask.
+ * @param[in] if_set   Значение, если маска состоит из единиц.
+ * @param[in] if_clear Значение, если маска равна 0.
+ * @return Выбранное значение.
+ */
+static inline double select_double(uint64_t mask, double if_set, double if_clear) {
+    uint64_t set_bits = 0;
+    uint64_t clear_bits = 0;
+    memcpy(&set_bits, &if_set, sizeof(set_bits));
+    memcpy(&clear_bits, &if_clear, sizeof(clear_bits));
+
+    uint64_t bits = (set_bits & mask) | (clear_bits & ~mask);
+    double value = 0;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+#endif // BRANCHLESS_SELECT_H
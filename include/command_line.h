@@ -0,0 +1,35 @@
+/**
+ * @file command_line.h
+ * @brief Заголовочный файл неинтерактивного режима работы с аргументами командной строки.
+ *
+ * @details
+ * Этот файл содержит объявление функции, которая разбирает аргументы командной строки
+ * и выполняет действие без меню и без установки локали:
+ * - `solver a b c` - решает одно уравнение и печатает запись результата.
+ * - `solver --batch in.txt [--out res.txt] [--format text|csv]` - решает все уравнения файла.
+ * - `solver --follow in1.txt [in2.txt ...] --out res.txt` - запускает режим слежения.
+ * - `solver --dir in_dir --out res.txt [--per-file] [--no-uring]` - решает уравнения всех файлов каталога.
+ * - `solver --batch in.txt --out res.bin --format f32|fixed [--precision N]` - записывает
+ *   результаты в упакованном двоичном формате.
+ * - `solver --decode res.bin [--out res.txt]` - декодирует упакованный файл результатов.
+ * - `--dedup` с `--batch` или `--dir` - решает повторы в пакетах один раз и печатает долю повторов.
+ * - `solver --test` - запускает режим тестов.
+ *
+ * Локаль устанавливается только при указании `--locale`.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+#ifndef COMMAND_LINE_H
+#define COMMAND_LINE_H
+
+/**
+ * @brief Выполняет программу в неинтерактивном режиме по аргументам командной строки.
+ *
+ * @param[in] argc Количество аргументов командной строки.
+ * @param[in] argv Аргументы командной строки.
+ * @return SUCCESS при успешном выполнении, иначе ERROR_CODE.
+ */
+int run_command_line(int argc, char* argv[]);
+
+#endif // COMMAND_LINE_H
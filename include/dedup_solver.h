@@ -0,0 +1,69 @@
+/**
+ * @file dedup_solver.h
+ * @brief Заголовочный файл пакетного решения уравнений с исключением повторов.
+ *
+ * @details
+ * Этот файл содержит объявления для необязательного предварительного прохода пакетного решения:
+ * одинаковые тройки коэффициентов пакета находятся по хешу, каждая уникальная тройка
+ * решается один раз, а результаты раскладываются обратно по исходным позициям.
+ * Проход окупается, когда в пакетах много точных повторов, поэтому функции накапливают
+ * статистику, по которой видно долю повторов.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+#ifndef DEDUP_SOLVER_H
+#define DEDUP_SOLVER_H
+#include <stddef.h>
+#include "equation.h"
+
+/**
+ * @brief Максимальное количество уравнений, среди которых ищутся повторы за один проход.
+ */
+const size_t DEDUP_BLOCK_SIZE = 1024;
+
+/**
+ * @struct DedupStats
+ * @brief Структура для накопления статистики исключения повторов.
+ *
+ * @details
+ * Нулевая структура соответствует пустой статистике.
+ */
+struct DedupStats {
+    size_t num_equations; /**< Количество решенных уравнений. */
+    size_t num_unique;    /**< Количество уникальных уравнений, которые решались на самом деле. */
+};
+
+/**
+ * @brief Решает пакет квадратных уравнений, решая каждую уникальную тройку коэффициентов один раз.
+ *
+ * @details
+ * Результаты совпадают с результатами @ref solve_square_equations. Повторы ищутся среди
+ * DEDUP_BLOCK_SIZE последовательных уравнений, коэффициенты сравниваются побитово.
+ * Функция не выделяет динамическую память.
+ *
+ * @param[in]     coeffts Массив коэффициентов уравнений.
+ * @param[out]    results Массив для результатов, размером не менее count.
+ * @param[in]     count   Количество уравнений в пакете.
+ * @param[in,out] stats   Статистика, к которой добавляются данные пакета, или NULL.
+ */
+void solve_square_equations_dedup(const SquareEquationCoefficient* coeffts, SquareEquationResult* results,
+                                  size_t count, DedupStats* stats);
+
+/**
+ * @brief Добавляет статистику одного прохода к другой.
+ *
+ * @param[in,out] total Общая статистика.
+ * @param[in]     part  Добавляемая статистика.
+ */
+void merge_dedup_stats(DedupStats* total, const DedupStats* part);
+
+/**
+ * @brief Вычисляет долю повторов.
+ *
+ * @param[in] stats Статистика.
+ * @return Доля уравнений, не потребовавших решения, от 0 до 1.
+ */
+double dedup_ratio(const DedupStats* stats);
+
+#endif // DEDUP_SOLVER_H
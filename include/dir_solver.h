@@ -0,0 +1,63 @@
+/**
+ * @file dir_solver.h
+ * @brief Заголовочный файл пакетного решения уравнений из каталога с множеством небольших файлов.
+ *
+ * @details
+ * Этот файл содержит объявления для режима обработки каталога: каждый обычный файл каталога
+ * содержит строки с коэффициентами `a b c`. Результаты записываются либо в одноименные файлы
+ * выходного каталога, либо в один общий файл, где каждая запись предваряется именем входного файла.
+ *
+ * В Linux чтение и запись выполняются через io_uring, так что одновременно выполняются
+ * до DIRECTORY_QUEUE_DEPTH операций, а разбор и решение файла начинаются сразу после
+ * завершения его чтения. Если io_uring недоступен, файлы обрабатываются пулом потоков через pread.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+#ifndef DIR_SOLVER_H
+#define DIR_SOLVER_H
+#include <stdbool.h>
+#include "record_io.h"
+#include "dedup_solver.h"
+
+/**
+ * @brief Максимальное количество файлов, одновременно обрабатываемых через io_uring.
+ */
+const unsigned DIRECTORY_QUEUE_DEPTH = 256;
+
+/**
+ * @enum DirectoryOutput
+ * @brief Перечисление способов записи результатов обработки каталога.
+ */
+enum DirectoryOutput {
+    DIRECTORY_OUTPUT_COMBINED, /**< Один общий файл, записи предваряются именем входного файла. */
+    DIRECTORY_OUTPUT_PER_FILE  /**< Одноименный файл в выходном каталоге для каждого входного файла. */
+};
+
+/**
+ * @struct DirectoryOptions
+ * @brief Структура для хранения параметров обработки каталога.
+ */
+struct DirectoryOptions {
+    DirectoryOutput output;  /**< Способ записи результатов. */
+    RecordFormat format;     /**< Формат записей результата. */
+    bool use_io_uring;       /**< Использовать ли io_uring, если он доступен. */
+    DedupStats* dedup_stats; /**< Статистика исключения повторов или NULL, если повторы не исключаются. */
+};
+
+/**
+ * @brief Решает уравнения всех файлов каталога.
+ *
+ * @details
+ * Обрабатываются только обычные файлы, подкаталоги пропускаются. Порядок файлов в общем
+ * выходном файле не определен. Ошибка обработки одного файла не прерывает обработку остальных.
+ *
+ * @param[in] input_dir   Путь к входному каталогу.
+ * @param[in] output_path Путь к общему выходному файлу или к выходному каталогу,
+ *                        который должен отличаться от входного.
+ * @param[in] options     Параметры обработки.
+ * @return SUCCESS, если все файлы обработаны, иначе ERROR_CODE.
+ */
+int solve_directory(const char* input_dir, const char* output_path, const DirectoryOptions* options);
+
+#endif // DIR_SOLVER_H
@@ -46,6 +46,23 @@ struct SquareEquationResult {
     RootNumber result_type; /**<  : 0 -   , 1 -  , 2 -  , 3 -   */
 };
 
+/**
+ * @struct CompactSquareEquationResult
+ * @brief        24 .
+ *
+ * @details
+ *        ,   
+ *  24     .    0.
+ */
+struct CompactSquareEquationResult {
+    double x1;                  /**<     0 */
+    double x2;                  /**<     0 */
+    unsigned char result_type;  /**<  :  @ref RootNumber */
+    unsigned char reserved[7];  /**< ,   */
+};
+
+static_assert(sizeof(CompactSquareEquationResult) == 24, "    24 ");
+
 /**
  * @struct SquareEquationCoefficient
  * @brief      .
@@ -0,0 +1,66 @@
+/**
+ * @file follow_solver.h
+ * @brief Заголовочный файл режима слежения за дописываемыми входными файлами.
+ *
+ * @details
+ * Этот файл содержит объявления функций для режима слежения: программа следит за одним
+ * или несколькими входными файлами, в конец которых дописываются строки с коэффициентами,
+ * решает новые уравнения пакетами по мере их появления и дописывает результаты в выходной файл.
+ *
+ * Для каждого входного файла сохраняется контрольная точка - смещение в байтах первой
+ * необработанной строки - в файле с суффиксом @ref FOLLOW_CHECKPOINT_SUFFIX. После перезапуска
+ * обработка продолжается с этого смещения.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+#ifndef FOLLOW_SOLVER_H
+#define FOLLOW_SOLVER_H
+#include <stddef.h>
+
+/**
+ * @brief Максимальное количество одновременно отслеживаемых файлов.
+ */
+const size_t MAX_FOLLOWED_FILES = 64;
+
+/**
+ * @brief Суффикс, добавляемый к имени входного файла для получения имени файла контрольной точки.
+ */
+const char* const FOLLOW_CHECKPOINT_SUFFIX = ".offset";
+
+/**
+ * @brief Следит за входными файлами и решает дописываемые в них уравнения.
+ *
+ * @details
+ * Каждая строка входного файла должна содержать коэффициенты `a b c`. Новые строки читаются
+ * блоками, решаются пакетами и дописываются в выходной файл в формате @ref format_solution_record.
+ * Если входных файлов несколько, каждая запись предваряется именем входного файла.
+ * Некорректные строки пропускаются с сообщением в stderr.
+ *
+ * В Linux ожидание новых данных выполняется через inotify, в остальных системах - опросом
+ * с небольшим интервалом. Функция работает, пока не будет вызвана @ref stop_following
+ * или не получен сигнал SIGINT.
+ *
+ * @param[in] input_paths Массив путей к входным файлам.
+ * @param[in] num_inputs  Количество входных файлов, не более MAX_FOLLOWED_FILES.
+ * @param[in] output_path Путь к выходному файлу, в который дописываются результаты.
+ * @return SUCCESS при штатной остановке, иначе ERROR_CODE.
+ */
+int follow_files(const char* const* input_paths, size_t num_inputs, const char* output_path);
+
+/**
+ * @brief Запрашивает остановку @ref follow_files.
+ *
+ * @details
+ * Функцию можно вызывать из обработчика сигнала или из другого потока.
+ */
+void stop_following();
+
+/**
+ * @brief Запускает режим слежения, запрашивая пути к файлам у пользователя.
+ *
+ * @return SUCCESS при штатной остановке, иначе ERROR_CODE.
+ */
+int run_follow_mode();
+
+#endif // FOLLOW_SOLVER_H
@@ -0,0 +1,131 @@
+/**
+ * @file int_solver.h
+ * @brief Заголовочный файл точного решения квадратных уравнений с целыми коэффициентами.
+ *
+ * @details
+ * Этот файл содержит объявления структур и функций для решения уравнений
+ * `ax^2 + bx + c = 0` с целыми коэффициентами без погрешности. Дискриминант вычисляется
+ * точно в 128-битных целых числах, поэтому количество корней определяется без EPSILON.
+ * Если дискриминант является полным квадратом, корни возвращаются в виде точных
+ * несократимых дробей, а sqrt не вызывается.
+ *
+ * Основные функции:
+ * - @ref is_int_coefficient: проверяет, что коэффициенты целые, и преобразует их.
+ * - @ref solve_int_square_equation: точно решает уравнение с целыми коэффициентами.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+#ifndef INT_SOLVER_H
+#define INT_SOLVER_H
+#include <stddef.h>
+#include <stdbool.h>
+#include "equation.h"
+
+/**
+ * @brief Максимальный модуль целого коэффициента.
+ *
+ * @details
+ * Значение равно 2^53: до этой границы все целые числа точно представимы в double,
+ * а дискриминант и числители корней помещаются в 128-битные и 64-битные целые соответственно.
+ */
+const long long INT_COEFF_LIMIT = 1LL << 53;
+
+/**
+ * @brief Максимальный модуль коэффициента для быстрого пакетного пути.
+ *
+ * @details
+ * Значение равно 2^25: при таком модуле коэффициентов |b^2 - 4ac| < 2^53, поэтому дискриминант
+ * вычисляется в double точно и пакет может обрабатываться векторными инструкциями.
+ */
+const long long SMALL_INT_COEFF_LIMIT = 1LL << 25;
+
+/**
+ * @struct IntSquareEquationCoefficient
+ * @brief Структура для хранения целых коэффициентов квадратного уравнения.
+ */
+struct IntSquareEquationCoefficient {
+    long long a; /**< Коэффициент a */
+    long long b; /**< Коэффициент b */
+    long long c; /**< Коэффициент c */
+};
+
+/**
+ * @struct RationalRoot
+ * @brief Структура для хранения корня в виде несократимой дроби num / den.
+ */
+struct RationalRoot {
+    long long num; /**< Числитель */
+    long long den; /**< Знаменатель, всегда больше нуля */
+};
+
+/**
+ * @struct ExactSquareEquationResult
+ * @brief Структура для хранения результата точного решения квадратного уравнения.
+ *
+ * @details
+ * Поле result заполняется всегда и совместимо с результатом @ref solve_square_equation.
+ * Поля x1_exact и x2_exact заполняются, только если is_rational равно true,
+ * и соответствуют существующим корням result.x1 и result.x2.
+ */
+struct ExactSquareEquationResult {
+    SquareEquationResult result; /**< Тип результата и корни в виде double */
+    bool is_rational;            /**< Являются ли корни рациональными */
+    RationalRoot x1_exact;       /**< Первый корень в виде дроби */
+    RationalRoot x2_exact;       /**< Второй корень в виде дроби */
+};
+
+/**
+ * @brief Проверяет, являются ли коэффициенты уравнения целыми, и преобразует их.
+ *
+ * @details
+ * Коэффициенты считаются целыми, если они не имеют дробной части и их модуль
+ * не превышает INT_COEFF_LIMIT.
+ *
+ * @param[in]  coeffts     Коэффициенты уравнения.
+ * @param[out] int_coeffts Указатель на структуру для целых коэффициентов или NULL.
+ * @return true, если все коэффициенты целые, иначе false.
+ */
+bool is_int_coefficient(SquareEquationCoefficient coeffts, IntSquareEquationCoefficient* int_coeffts);
+
+/**
+ * @brief Проверяет, являются ли коэффициенты уравнения целыми по модулю не больше SMALL_INT_COEFF_LIMIT.
+ *
+ * @param[in] coeffts Коэффициенты уравнения.
+ * @return true, если уравнение может быть решено @ref solve_small_int_square_equations, иначе false.
+ */
+bool is_small_int_coefficient(SquareEquationCoefficient coeffts);
+
+/**
+ * @brief Точно решает квадратное уравнение с целыми коэффициентами.
+ *
+ * @details
+ * Количество корней определяется по точному значению дискриминанта. Если корни
+ * рациональны (линейное уравнение, нулевой дискриминант или дискриминант - полный квадрат),
+ * они также возвращаются в виде несократимых дробей.
+ *
+ * @param[in]  coeffts Целые коэффициенты уравнения, по модулю не больше INT_COEFF_LIMIT.
+ * @param[out] result  Указатель на структуру для результата.
+ * @return SUCCESS при успешном решении, ERROR_CODE, если коэффициент выходит за INT_COEFF_LIMIT.
+ */
+int solve_int_square_equation(IntSquareEquationCoefficient coeffts, ExactSquareEquationResult* result);
+
+/**
+ * @brief Решает пакет уравнений с небольшими целыми коэффициентами.
+ *
+ * @details
+ * Коэффициенты передаются в виде отдельных массивов a, b и c. Все коэффициенты должны быть
+ * целыми по модулю не больше SMALL_INT_COEFF_LIMIT, тогда дискриминант вычисляется в double
+ * без погрешности и сравнивается с нулем без EPSILON. Результаты совпадают с результатами
+ * @ref solve_int_square_equation.
+ *
+ * @param[in]  a       Массив коэффициентов a.
+ * @param[in]  b       Массив коэффициентов b.
+ * @param[in]  c       Массив коэффициентов c.
+ * @param[out] results Массив для результатов, размером не менее count.
+ * @param[in]  count   Количество уравнений в пакете.
+ */
+void solve_small_int_square_equations(const double* a, const double* b, const double* c,
+                                      SquareEquationResult* results, size_t count);
+
+#endif // INT_SOLVER_H
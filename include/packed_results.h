@@ -0,0 +1,138 @@
+/**
+ * @file packed_results.h
+ * @brief Заголовочный файл компактного двоичного формата файлов результатов.
+ *
+ * @details
+ * Этот файл содержит объявления для записи и чтения результатов решения в упакованном виде.
+ * Коэффициенты в файл не записываются: i-я запись соответствует i-му корректному уравнению
+ * входных данных (некорректные строки пропускаются, как и в текстовых форматах).
+ *
+ * Файл состоит из заголовка PACKED_FILE_HEADER_SIZE байт и последовательности блоков
+ * не более чем по PACKED_BLOCK_SIZE записей:
+ * - заголовок файла: сигнатура `SQPK`, версия формата, способ хранения корней, точность, резерв;
+ * - заголовок блока: количество записей (4 байта), количество корней (4 байта),
+ *   способ хранения корней блока (1 байт), резерв (3 байта);
+ * - битовая карта типов: тип каждой записи занимает 2 бита, по 4 записи в байте;
+ * - корни: только существующие корни записей подряд (x1 для OneRoot, x1 и x2 для TwoRoots),
+ *   каждый в виде float32 или целого числа 32 бита с масштабом 10^precision.
+ *
+ * Если корень блока не представим выбранным способом (не помещается в float32, становится в нем
+ * нулем или не помещается в 32 бита с заданным масштабом), корни всего блока хранятся в виде double.
+ * Целые значения округляются так же, как printf("%.*f") с той же точностью. Числа записываются
+ * в порядке байтов машины (little-endian на x86 и ARM).
+ *
+ * Основные функции:
+ * - @ref write_packed_header и @ref encode_packed_block: кодирование.
+ * - @ref open_packed_reader и @ref read_packed_block: потоковое декодирование файла по блокам.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+#ifndef PACKED_RESULTS_H
+#define PACKED_RESULTS_H
+#include <stdio.h>
+#include <stddef.h>
+#include "equation.h"
+
+/**
+ * @brief Максимальное количество записей в одном блоке.
+ */
+const size_t PACKED_BLOCK_SIZE = 1024;
+
+/**
+ * @brief Максимальная точность (количество знаков после запятой) для хранения корней целыми числами.
+ */
+const unsigned PACKED_MAX_PRECISION = 9;
+
+/**
+ * @brief Размер заголовка файла в байтах.
+ */
+const size_t PACKED_FILE_HEADER_SIZE = 8;
+
+/**
+ * @brief Размер заголовка блока в байтах.
+ */
+const size_t PACKED_BLOCK_HEADER_SIZE = 12;
+
+/**
+ * @brief Максимальный размер закодированного блока в байтах.
+ */
+const size_t PACKED_MAX_BLOCK_BYTES = PACKED_BLOCK_HEADER_SIZE + PACKED_BLOCK_SIZE / 4 +
+                                      2 * PACKED_BLOCK_SIZE * sizeof(double);
+
+/**
+ * @enum PackedRoots
+ * @brief Перечисление способов хранения корней.
+ */
+enum PackedRoots {
+    PACKED_ROOTS_FLOAT32 = 1, /**< Числа float32. */
+    PACKED_ROOTS_FIXED32 = 2, /**< Целые числа 32 бита, равные корню, умноженному на 10^precision. */
+    PACKED_ROOTS_FLOAT64 = 3  /**< Числа double, используются для блоков с непредставимыми корнями. */
+};
+
+/**
+ * @struct PackedEncoding
+ * @brief Структура для хранения параметров упакованного формата.
+ */
+struct PackedEncoding {
+    PackedRoots roots;  /**< Способ хранения корней. */
+    unsigned precision; /**< Количество знаков после запятой для PACKED_ROOTS_FIXED32. */
+};
+
+/**
+ * @struct PackedReader
+ * @brief Структура для хранения состояния потокового чтения упакованного файла.
+ */
+struct PackedReader {
+    FILE* input;             /**< Входной файл. */
+    PackedEncoding encoding; /**< Параметры формата из заголовка файла. */
+};
+
+/**
+ * @brief Записывает заголовок упакованного файла в буфер.
+ *
+ * @param[in]  encoding Параметры формата.
+ * @param[out] buffer   Буфер размером не менее PACKED_FILE_HEADER_SIZE байт.
+ * @return Количество записанных байт.
+ */
+size_t write_packed_header(const PackedEncoding* encoding, unsigned char* buffer);
+
+/**
+ * @brief Кодирует блок результатов.
+ *
+ * @details
+ * Отсутствующие корни не записываются, поэтому их значения в results не используются.
+ *
+ * @param[in]  encoding Параметры формата.
+ * @param[in]  results  Массив результатов.
+ * @param[in]  count    Количество результатов, не более PACKED_BLOCK_SIZE.
+ * @param[out] buffer   Буфер размером не менее PACKED_MAX_BLOCK_BYTES байт.
+ * @return Количество записанных байт.
+ */
+size_t encode_packed_block(const PackedEncoding* encoding, const SquareEquationResult* results,
+                           size_t count, unsigned char* buffer);
+
+/**
+ * @brief Начинает чтение упакованного файла и проверяет его заголовок.
+ *
+ * @param[out] reader Состояние чтения.
+ * @param[in]  input  Входной файл, открытый в двоичном режиме.
+ * @return SUCCESS, если заголовок корректен, иначе ERROR_CODE.
+ */
+int open_packed_reader(PackedReader* reader, FILE* input);
+
+/**
+ * @brief Читает и декодирует следующий блок упакованного файла.
+ *
+ * @details
+ * Отсутствующие корни записываются как 0. После последнего блока функция возвращает
+ * SUCCESS и *count, равное 0.
+ *
+ * @param[in,out] reader  Состояние чтения.
+ * @param[out]    results Массив результатов размером не менее PACKED_BLOCK_SIZE.
+ * @param[out]    count   Количество декодированных результатов.
+ * @return SUCCESS при успехе, ERROR_CODE при ошибке чтения или поврежденном блоке.
+ */
+int read_packed_block(PackedReader* reader, SquareEquationResult* results, size_t* count);
+
+#endif // PACKED_RESULTS_H
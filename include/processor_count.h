@@ -0,0 +1,37 @@
+/**
+ * @file processor_count.h
+ * @brief Заголовочный файл функции определения количества процессоров.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+#ifndef PROCESSOR_COUNT_H
+#define PROCESSOR_COUNT_H
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Возвращает количество доступных процессоров.
+ *
+ * @details
+ * Используется вместо std::thread::hardware_concurrency, чтобы программа не зависела
+ * от libstdc++ (загрузка этой библиотеки заметно замедляет запуск программы).
+ *
+ * @return Количество процессоров, не меньше 1.
+ */
+static inline unsigned count_processors(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (unsigned) info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (unsigned) count : 1;
+#endif
+}
+
+#endif // PROCESSOR_COUNT_H
@@ -0,0 +1,86 @@
+/**
+ * @file record_io.h
+ * @brief Заголовочный файл функций разбора и форматирования строковых записей уравнений.
+ *
+ * @details
+ * Этот файл содержит объявления функций для неинтерактивной работы с уравнениями:
+ * разбора строки с коэффициентами `a b c` и форматирования результата решения
+ * в одну строку для записи в файл результатов.
+ *
+ * Основные функции:
+ * - @ref parse_coefficients_line: разбирает строку с коэффициентами.
+ * - @ref format_solution_record: форматирует результат решения в буфер.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+#ifndef RECORD_IO_H
+#define RECORD_IO_H
+#include <stddef.h>
+#include "equation.h"
+
+/**
+ * @brief Максимальная длина строки с коэффициентами, включая завершающий ноль.
+ */
+const size_t MAX_INPUT_LINE_LENGTH = 256;
+
+/**
+ * @brief Максимальная длина одной отформатированной записи результата, включая завершающий ноль.
+ *
+ * @details
+ * Корень, выведенный через "%.2f", занимает до 313 символов (DBL_MAX содержит 309 цифр
+ * до запятой), коэффициент, выведенный через "%.17g", - до 24 символов. Запись с двумя
+ * корнями, тремя коэффициентами, типом, разделителями и переводом строки помещается в 720 символов.
+ */
+const size_t MAX_RECORD_LENGTH = 1024;
+
+/**
+ * @enum RecordFormat
+ * @brief Перечисление форматов записи результата.
+ */
+enum RecordFormat {
+    RECORD_TEXT, /**< Значения через пробел: `a b c type [x1 [x2]]`. */
+    RECORD_CSV   /**< Значения через запятую: `a,b,c,type,x1,x2`, отсутствующие корни - пустые поля. */
+};
+
+/**
+ * @brief Заголовок CSV-файла результатов.
+ */
+const char* const CSV_HEADER = "a,b,c,type,x1,x2\n";
+
+/**
+ * @brief Заголовок CSV-файла результатов, записи которого предваряются именем входного файла.
+ */
+const char* const CSV_FILE_HEADER = "file,a,b,c,type,x1,x2\n";
+
+/**
+ * @brief Разбирает строку с коэффициентами квадратного уравнения.
+ *
+ * @details
+ * Строка должна содержать ровно три числа `a b c`, разделенных пробельными символами.
+ * Строка может не завершаться нулем: разбираются только первые length символов.
+ *
+ * @param[in]  line    Указатель на начало строки.
+ * @param[in]  length  Длина строки без символа перевода строки.
+ * @param[out] coeffts Указатель на структуру, в которую будут сохранены коэффициенты.
+ * @return SUCCESS при успешном разборе, иначе ERROR_CODE.
+ */
+int parse_coefficients_line(const char* line, size_t length, SquareEquationCoefficient* coeffts);
+
+/**
+ * @brief Форматирует результат решения квадратного уравнения в одну строку.
+ *
+ * @details
+ * Запись содержит коэффициенты, числовое значение @ref RootNumber и корни, если они есть,
+ * в формате format. Строка завершается символом перевода строки.
+ *
+ * @param[out] buffer  Буфер для записи, размером не менее MAX_RECORD_LENGTH.
+ * @param[in]  format  Формат записи.
+ * @param[in]  coeffts Коэффициенты решенного уравнения.
+ * @param[in]  result  Результат решения уравнения.
+ * @return Количество записанных символов без завершающего нуля.
+ */
+size_t format_solution_record(char* buffer, RecordFormat format,
+                              SquareEquationCoefficient coeffts, SquareEquationResult result);
+
+#endif // RECORD_IO_H
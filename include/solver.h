@@ -13,6 +13,7 @@
  */
 #ifndef SOLVER_H
 #define SOLVER_H
+#include <stddef.h>
 #include "equation.h"
 
 /**
@@ -38,4 +39,52 @@
  */
 SquareEquationResult solve_square_equation(SquareEquationCoefficient coeffts);
 
+/**
+ * @brief     ax^2 + bx + c = 0   .
+ *
+ * @details
+ *       ,   @ref solve_square_equation,    
+ *    ,  
+ *   ( ,  ,  )    
+ *   .       ,   
+ *          .
+ *
+ * @param[in] coeffts ,    .
+ * @return CompactSquareEquationResult  ,    0.
+ */
+CompactSquareEquationResult solve_square_equation_branchless(SquareEquationCoefficient coeffts);
+
+/**
+ * @brief    .
+ *
+ * @details
+ *    count      coeffts[i]  results[i].
+ *      ,   @ref solve_int_square_equation,
+ *  -  ,   @ref solve_square_equation.
+ *
+ * @param[in]  coeffts   .
+ * @param[out] results   ,    count.
+ * @param[in]  count      .
+ */
+void solve_square_equations(const SquareEquationCoefficient* coeffts, SquareEquationResult* results, size_t count);
+
+/**
+ * @brief    ,    (SoA).
+ *
+ * @details
+ *     a[i]x^2 + b[i]x + c[i] = 0  ,  @ref solve_square_equations,
+ *     x1[i]  x2[i],    -  result_type[i]    @ref RootNumber.
+ *     .     0.
+ *
+ * @param[in]  a             a.
+ * @param[in]  b             b.
+ * @param[in]  c             c.
+ * @param[out] x1            .
+ * @param[out] x2            .
+ * @param[out] result_type   .
+ * @param[in]  count          .
+ */
+void solve_square_equations_soa(const double* a, const double* b, const double* c,
+                                double* x1, double* x2, unsigned char* result_type, size_t count);
+
 #endif // SOLVER_H
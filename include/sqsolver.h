@@ -0,0 +1,144 @@
+/**
+ * @file sqsolver.h
+ * @brief Заголовочный файл C API библиотеки решения квадратных уравнений.
+ *
+ * @details
+ * Этот файл содержит стабильный C-интерфейс библиотеки, который можно подключать
+ * из C и C++ без остальных заголовочных файлов программы:
+ * - @ref sqsolver_solve: решает одно уравнение.
+ * - @ref sqsolver_solve_batch: решает пакет уравнений, заданный массивами вызывающего кода (SoA),
+ *   без выделения памяти внутри вызова.
+ * - @ref sqsolver_create и @ref sqsolver_destroy: создают и уничтожают контекст, который хранит
+ *   пул потоков и переиспользуется между вызовами.
+ *
+ * Библиотека собирается из файлов solver.cpp, int_solver.cpp, comparison_with_zero.cpp
+ * и sqsolver.cpp и компонуется с POSIX threads (-pthread). При сборке разделяемой библиотеки нужно определить SQSOLVER_SHARED
+ * и SQSOLVER_BUILD, при ее использовании - только SQSOLVER_SHARED.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+#ifndef SQSOLVER_H
+#define SQSOLVER_H
+#include <stddef.h>
+
+#if defined(SQSOLVER_SHARED) && defined(_WIN32)
+#  ifdef SQSOLVER_BUILD
+#    define SQSOLVER_API __declspec(dllexport)
+#  else
+#    define SQSOLVER_API __declspec(dllimport)
+#  endif
+#elif defined(SQSOLVER_SHARED) && defined(__GNUC__)
+#  define SQSOLVER_API __attribute__((visibility("default")))
+#else
+#  define SQSOLVER_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Версия C API. Увеличивается при несовместимых изменениях интерфейса.
+ */
+#define SQSOLVER_API_VERSION 1
+
+/**
+ * @brief Коды возврата функций C API.
+ */
+#define SQSOLVER_OK     0  /**< Успешное выполнение. */
+#define SQSOLVER_ERROR -1  /**< Некорректные аргументы или ошибка создания контекста. */
+
+/**
+ * @brief Типы результата решения. Значения совпадают с RootNumber.
+ */
+#define SQSOLVER_NO_ROOTS  0 /**< Уравнение не имеет действительных корней. */
+#define SQSOLVER_ONE_ROOT  1 /**< Уравнение имеет один действительный корень. */
+#define SQSOLVER_TWO_ROOTS 2 /**< Уравнение имеет два действительных корня. */
+#define SQSOLVER_INF_ROOTS 3 /**< Уравнение имеет бесконечно много корней. */
+
+/**
+ * @struct sqsolver_result
+ * @brief Структура для хранения результата решения одного уравнения.
+ */
+typedef struct sqsolver_result {
+    double x1;       /**< Первый корень или 0, если его нет. */
+    double x2;       /**< Второй корень или 0, если его нет. */
+    int result_type; /**< Тип результата: одно из значений SQSOLVER_*_ROOTS. */
+} sqsolver_result;
+
+/**
+ * @brief Непрозрачный контекст библиотеки с пулом потоков.
+ */
+typedef struct sqsolver_context sqsolver_context;
+
+/**
+ * @brief Возвращает версию C API, с которой собрана библиотека.
+ *
+ * @return SQSOLVER_API_VERSION библиотеки.
+ */
+SQSOLVER_API int sqsolver_api_version(void);
+
+/**
+ * @brief Решает одно квадратное уравнение ax^2 + bx + c = 0.
+ *
+ * @details
+ * Результат совпадает с результатом @ref sqsolver_solve_batch для того же уравнения:
+ * уравнения с целыми коэффициентами решаются точно, без EPSILON.
+ *
+ * @param[in]  a      Коэффициент при x^2.
+ * @param[in]  b      Коэффициент при x.
+ * @param[in]  c      Свободный член.
+ * @param[out] result Указатель на структуру для результата.
+ * @return SQSOLVER_OK при успехе, SQSOLVER_ERROR, если result равен NULL.
+ */
+SQSOLVER_API int sqsolver_solve(double a, double b, double c, sqsolver_result* result);
+
+/**
+ * @brief Создает контекст для пакетного решения.
+ *
+ * @details
+ * Контекст запускает num_threads - 1 рабочих потоков, которые вместе с вызывающим потоком
+ * обрабатывают большие пакеты. Потоки создаются один раз и переиспользуются всеми вызовами
+ * @ref sqsolver_solve_batch с этим контекстом.
+ *
+ * @param[in] num_threads Количество потоков, 0 - по числу процессоров.
+ * @return Указатель на контекст или NULL при ошибке.
+ */
+SQSOLVER_API sqsolver_context* sqsolver_create(unsigned num_threads);
+
+/**
+ * @brief Останавливает потоки контекста и освобождает его.
+ *
+ * @param[in] context Контекст или NULL.
+ */
+SQSOLVER_API void sqsolver_destroy(sqsolver_context* context);
+
+/**
+ * @brief Решает пакет квадратных уравнений, заданный массивами вызывающего кода.
+ *
+ * @details
+ * Функция решает уравнения a[i]x^2 + b[i]x + c[i] = 0 и записывает корни в x1[i] и x2[i],
+ * а тип результата - в result_type[i]. Все массивы принадлежат вызывающему коду, внутри
+ * вызова память не выделяется. Если context равен NULL, пакет решается в вызывающем потоке.
+ * Вызовы с одним контекстом из разных потоков выполняются по очереди.
+ *
+ * @param[in]  context     Контекст или NULL.
+ * @param[in]  a           Массив коэффициентов a.
+ * @param[in]  b           Массив коэффициентов b.
+ * @param[in]  c           Массив коэффициентов c.
+ * @param[out] x1          Массив первых корней.
+ * @param[out] x2          Массив вторых корней.
+ * @param[out] result_type Массив типов результата.
+ * @param[in]  count       Количество уравнений.
+ * @return SQSOLVER_OK при успехе, SQSOLVER_ERROR при некорректных аргументах.
+ */
+SQSOLVER_API int sqsolver_solve_batch(sqsolver_context* context,
+                                      const double* a, const double* b, const double* c,
+                                      double* x1, double* x2, unsigned char* result_type, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SQSOLVER_H
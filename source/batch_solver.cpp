@@ -0,0 +1,270 @@
+/**
+ * @file batch_solver.cpp
+ * @brief Пакетное решение уравнений из текстовых данных.
+ *
+ * @details
+ * Этот файл содержит функции для неинтерактивного решения большого числа уравнений.
+ * Входные данные читаются блоками по STREAM_CHUNK_SIZE байт, строки разбираются в пакеты
+ * по BATCH_SIZE уравнений, а результаты форматируются в буфер и записываются одним вызовом fwrite.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdbool.h>
+#include "batch_solver.h"
+#include "solver.h"
+#include "error_code.h"
+
+/**
+ * @brief Размер блока, читаемого из входного файла за один раз.
+ */
+const size_t STREAM_CHUNK_SIZE = 1024 * 1024;
+
+static_assert(BATCH_SIZE <= PACKED_BLOCK_SIZE, "Пакет должен кодироваться одним упакованным блоком");
+
+/**
+ * @brief Начальный размер выходного буфера.
+ */
+const size_t INITIAL_OUTPUT_CAPACITY = 64 * 1024;
+
+/**
+ * @brief Максимальная длина фрагмента некорректной строки в сообщении об ошибке.
+ */
+const int MAX_REPORTED_LINE_LENGTH = 40;
+
+/**
+ * @brief Дописывает данные в выходной буфер, при необходимости расширяя его.
+ *
+ * @param[in,out] output Выходной буфер.
+ * @param[in]     data   Данные для записи.
+ * @param[in]     size   Количество байт.
+ * @return SUCCESS при успехе, ERROR_CODE при нехватке памяти.
+ */
+int append_output(OutputBuffer* output, const char* data, size_t size) {
+    assert(output != NULL);
+    assert(data != NULL || size == 0);
+
+    if (output->size + size > output->capacity) {
+        size_t capacity = output->capacity == 0 ? INITIAL_OUTPUT_CAPACITY : output->capacity;
+        while (capacity < output->size + size) {
+            capacity *= 2;
+        }
+
+        char* data_new = (char*) realloc(output->data, capacity);
+        if (data_new == NULL) {
+            return ERROR_CODE;
+        }
+        output->data = data_new;
+        output->capacity = capacity;
+    }
+
+    memcpy(output->data + output->size, data, size);
+    output->size += size;
+    return SUCCESS;
+}
+
+/**
+ * @brief Освобождает память выходного буфера.
+ *
+ * @param[in,out] output Выходной буфер.
+ */
+void free_output(OutputBuffer* output) {
+    assert(output != NULL);
+
+    free(output->data);
+    output->data = NULL;
+    output->size = 0;
+    output->capacity = 0;
+}
+
+/**
+ * @brief Решает пакет уравнений и дописывает отформатированные результаты в выходной буфер.
+ *
+ * @param[in]     coeffts Массив коэффициентов пакета.
+ * @param[in]     count   Количество уравнений в пакете.
+ * @param[in]     options Параметры пакетного решения.
+ * @param[in,out] output  Выходной буфер.
+ * @return SUCCESS при успехе, ERROR_CODE при нехватке памяти для результатов.
+ */
+static int write_batch(const SquareEquationCoefficient* coeffts, size_t count,
+                       const BatchOptions* options, OutputBuffer* output) {
+    SquareEquationResult results[BATCH_SIZE];
+    if (options->dedup_stats != NULL) {
+        solve_square_equations_dedup(coeffts, results, count, options->dedup_stats);
+    } else {
+        solve_square_equations(coeffts, results, count);
+    }
+
+    if (options->packed != NULL) {
+        if (count > 0) {
+            unsigned char block[PACKED_MAX_BLOCK_BYTES];
+            size_t length = encode_packed_block(options->packed, results, count, block);
+            if (append_output(output, (const char*) block, length) != SUCCESS) {
+                fprintf(stderr, "Недостаточно памяти для результатов.\n");
+                return ERROR_CODE;
+            }
+        }
+        return SUCCESS;
+    }
+
+    char record[MAX_RECORD_LENGTH] = "";
+    size_t tag_length = options->tag != NULL ? strlen(options->tag) : 0;
+    const char* separator = options->format == RECORD_CSV ? "," : ": ";
+
+    for (size_t i = 0; i < count; i++) {
+        size_t length = format_solution_record(record, options->format, coeffts[i], results[i]);
+        size_t record_start = output->size;
+        int status = SUCCESS;
+        if (tag_length > 0) {
+            status = append_output(output, options->tag, tag_length);
+            if (status == SUCCESS) {
+                status = append_output(output, separator, strlen(separator));
+            }
+        }
+        if (status == SUCCESS) {
+            status = append_output(output, record, length);
+        }
+        if (status != SUCCESS) {
+            output->size = record_start;
+            fprintf(stderr, "Недостаточно памяти для результатов.\n");
+            return ERROR_CODE;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * @brief Решает все полные строки буфера и дописывает результаты в выходной буфер.
+ *
+ * @details
+ * Уравнения накапливаются в пакет размером BATCH_SIZE, который решается
+ * @ref solve_square_equations или, если задана статистика исключения повторов,
+ * @ref solve_square_equations_dedup целиком.
+ *
+ * @param[in]     data     Входные данные.
+ * @param[in]     size     Размер входных данных.
+ * @param[in]     is_final Являются ли данные последними, то есть нужно ли обработать неполную строку.
+ * @param[in]     options  Параметры пакетного решения.
+ * @param[in,out] output   Выходной буфер.
+ * @param[out]    consumed Количество обработанных байт входных данных.
+ * @return SUCCESS при успехе, ERROR_CODE, если результаты не удалось записать в выходной буфер.
+ */
+int solve_lines(const char* data, size_t size, bool is_final, const BatchOptions* options,
+                OutputBuffer* output, size_t* consumed) {
+    assert(data != NULL || size == 0);
+    assert(options != NULL);
+    assert(output != NULL);
+    assert(consumed != NULL);
+
+    SquareEquationCoefficient coeffts[BATCH_SIZE];
+    size_t batch_size = 0;
+    size_t line_start = 0;
+
+    while (line_start < size) {
+        const char* newline = (const char*) memchr(data + line_start, '\n', size - line_start);
+        if (newline == NULL && !is_final) {
+            break;
+        }
+
+        size_t line_end = newline != NULL ? (size_t) (newline - data) : size;
+        size_t next_line = newline != NULL ? line_end + 1 : size;
+        if (line_end > line_start && data[line_end - 1] == '\r') {
+            line_end--;
+        }
+
+        if (line_end > line_start) {
+            if (parse_coefficients_line(data + line_start, line_end - line_start, &coeffts[batch_size]) == SUCCESS) {
+                if (++batch_size == BATCH_SIZE) {
+                    if (write_batch(coeffts, batch_size, options, output) != SUCCESS) {
+                        *consumed = line_start;
+                        return ERROR_CODE;
+                    }
+                    batch_size = 0;
+                }
+            } else {
+                int length = (int) (line_end - line_start);
+                fprintf(stderr, "%s%sпропущена некорректная строка: %.*s\n",
+                        options->tag != NULL ? options->tag : "", options->tag != NULL ? ": " : "",
+                        length < MAX_REPORTED_LINE_LENGTH ? length : MAX_REPORTED_LINE_LENGTH,
+                        data + line_start);
+            }
+        }
+        line_start = next_line;
+    }
+
+    *consumed = line_start;
+    return write_batch(coeffts, batch_size, options, output);
+}
+
+/**
+ * @brief Решает все уравнения входного файла и записывает результаты в выходной файл.
+ *
+ * @details
+ * Файл читается блоками по STREAM_CHUNK_SIZE байт. Неполная последняя строка блока
+ * переносится в начало буфера и обрабатывается вместе со следующим блоком.
+ *
+ * @param[in] input   Входной файл.
+ * @param[in] output  Выходной файл.
+ * @param[in] options Параметры пакетного решения.
+ * @return SUCCESS при успехе, иначе ERROR_CODE.
+ */
+int solve_stream(FILE* input, FILE* output, const BatchOptions* options) {
+    assert(input != NULL);
+    assert(output != NULL);
+    assert(options != NULL);
+
+    char* buffer = (char*) malloc(STREAM_CHUNK_SIZE);
+    if (buffer == NULL) {
+        fprintf(stderr, "Недостаточно памяти для входного буфера.\n");
+        return ERROR_CODE;
+    }
+
+    int status = SUCCESS;
+    if (options->packed != NULL) {
+        unsigned char header[PACKED_FILE_HEADER_SIZE];
+        size_t length = write_packed_header(options->packed, header);
+        status = fwrite(header, 1, length, output) == length ? SUCCESS : ERROR_CODE;
+    } else if (options->format == RECORD_CSV) {
+        status = fputs(CSV_HEADER, output) >= 0 ? SUCCESS : ERROR_CODE;
+    }
+    if (status != SUCCESS) {
+        fprintf(stderr, "Ошибка записи в выходной файл.\n");
+    }
+
+    OutputBuffer results = {};
+    size_t pending = 0;
+    bool at_eof = false;
+
+    while (!at_eof && status == SUCCESS) {
+        size_t bytes = fread(buffer + pending, 1, STREAM_CHUNK_SIZE - pending, input);
+        size_t size = pending + bytes;
+        at_eof = bytes == 0;
+
+        if (ferror(input)) {
+            fprintf(stderr, "Ошибка чтения входного файла.\n");
+            status = ERROR_CODE;
+            break;
+        }
+
+        bool is_line_too_long = size == STREAM_CHUNK_SIZE && memchr(buffer, '\n', size) == NULL;
+        size_t consumed = 0;
+        status = solve_lines(buffer, size, at_eof || is_line_too_long, options, &results, &consumed);
+        pending = size - consumed;
+        memmove(buffer, buffer + consumed, pending);
+
+        if (fwrite(results.data, 1, results.size, output) != results.size) {
+            fprintf(stderr, "Ошибка записи в выходной файл.\n");
+            status = ERROR_CODE;
+        }
+        results.size = 0;
+    }
+
+    free_output(&results);
+    free(buffer);
+    return status;
+}
@@ -0,0 +1,425 @@
+/**
+ * @file command_line.cpp
+ * @brief Неинтерактивный режим работы с аргументами командной строки.
+ *
+ * @details
+ * Этот файл содержит разбор аргументов командной строки и запуск соответствующего режима.
+ * Режим предназначен для вызова из скриптов, поэтому в нем нет меню, приглашений к вводу
+ * и установки локали, а результат одного уравнения печатается одним вызовом fwrite.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#include <assert.h>
+#include <stdbool.h>
+#include "command_line.h"
+#include "solver.h"
+#include "record_io.h"
+#include "batch_solver.h"
+#include "follow_solver.h"
+#include "dir_solver.h"
+#include "packed_results.h"
+#include "testmode_solver.h"
+#include "error_code.h"
+
+/**
+ * @brief Размер буфера стандартного вывода в пакетном режиме.
+ */
+const size_t OUTPUT_BUFFER_SIZE = 1024 * 1024;
+
+/**
+ * @brief Текст справки по аргументам командной строки.
+ */
+const char* const USAGE =
+    "Использование:\n"
+    "  solver a b c                                   решить одно уравнение\n"
+    "  solver --batch in.txt [--out res.txt]          решить все уравнения файла (- для stdin)\n"
+    "  solver --follow in.txt... --out res.txt        следить за дописываемыми файлами\n"
+    "  solver --dir in_dir --out res.txt|out_dir      решить уравнения всех файлов каталога\n"
+    "  solver --decode res.bin [--out res.txt]        декодировать упакованный файл результатов\n"
+    "  solver --test                                  запустить режим тестов\n"
+    "Параметры:\n"
+    "  --format text|csv                              формат записей результата\n"
+    "  --format f32|fixed [--precision N]             для --batch: упакованный двоичный формат, корни\n"
+    "                                                 в float32 или в целых с N знаками после запятой (2)\n"
+    "  --per-file                                     для --dir: отдельный файл результатов на каждый входной\n"
+    "  --no-uring                                     для --dir: не использовать io_uring\n"
+    "  --dedup                                        для --batch и --dir: решать повторы один раз\n"
+    "                                                 и вывести долю повторов в stderr\n"
+    "  --locale                                       установить локаль Rus\n";
+
+/**
+ * @enum CommandMode
+ * @brief Перечисление действий неинтерактивного режима.
+ */
+enum CommandMode {
+    COMMAND_NONE,   /**< Действие не указано. */
+    COMMAND_SINGLE, /**< Решение одного уравнения. */
+    COMMAND_BATCH,  /**< Решение всех уравнений файла. */
+    COMMAND_FOLLOW, /**< Слежение за дописываемыми файлами. */
+    COMMAND_DIR,    /**< Решение уравнений всех файлов каталога. */
+    COMMAND_DECODE, /**< Декодирование упакованного файла результатов. */
+    COMMAND_TEST,   /**< Режим тестов. */
+    COMMAND_HELP    /**< Вывод справки. */
+};
+
+/**
+ * @struct CommandOptions
+ * @brief Структура для хранения разобранных аргументов командной строки.
+ */
+struct CommandOptions {
+    CommandMode mode;                                  /**< Выбранное действие. */
+    RecordFormat format;                               /**< Формат записей результата. */
+    const char* input_path;                            /**< Путь к входному файлу или каталогу. */
+    const char* output_path;                           /**< Путь к выходному файлу или NULL для stdout. */
+    const char* follow_paths[MAX_FOLLOWED_FILES];      /**< Пути к отслеживаемым файлам. */
+    size_t num_follow_paths;                           /**< Количество отслеживаемых файлов. */
+    const char* numbers[3];                            /**< Коэффициенты одного уравнения в виде строк. */
+    size_t num_numbers;                                /**< Количество указанных коэффициентов. */
+    DirectoryOutput directory_output;                  /**< Способ записи результатов обработки каталога. */
+    bool use_io_uring;                                 /**< Использовать ли io_uring при обработке каталога. */
+    bool deduplicate;                                  /**< Исключать ли повторы уравнений в пакетах. */
+    bool packed;                                       /**< Записывать ли результаты в упакованном формате. */
+    PackedEncoding packed_encoding;                    /**< Параметры упакованного формата. */
+};
+
+/**
+ * @brief Возвращает значение параметра, следующего за его именем.
+ *
+ * @param[in]     argc Количество аргументов командной строки.
+ * @param[in]     argv Аргументы командной строки.
+ * @param[in,out] i    Индекс имени параметра, после вызова - индекс значения.
+ * @return Значение параметра или NULL, если оно не указано.
+ */
+static const char* take_value(int argc, char* argv[], int* i) {
+    if (*i + 1 >= argc) {
+        fprintf(stderr, "Не указано значение параметра %s.\n", argv[*i]);
+        return NULL;
+    }
+    return argv[++*i];
+}
+
+/**
+ * @brief Разбирает аргументы командной строки.
+ *
+ * @param[in]  argc    Количество аргументов командной строки.
+ * @param[in]  argv    Аргументы командной строки.
+ * @param[out] options Указатель на структуру для разобранных аргументов.
+ * @return SUCCESS при успешном разборе, иначе ERROR_CODE.
+ */
+static int parse_arguments(int argc, char* argv[], CommandOptions* options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+
+        if (strcmp(arg, "--batch") == 0) {
+            options->mode = COMMAND_BATCH;
+            if ((options->input_path = take_value(argc, argv, &i)) == NULL) {
+                return ERROR_CODE;
+            }
+        } else if (strcmp(arg, "--dir") == 0) {
+            options->mode = COMMAND_DIR;
+            if ((options->input_path = take_value(argc, argv, &i)) == NULL) {
+                return ERROR_CODE;
+            }
+        } else if (strcmp(arg, "--per-file") == 0) {
+            options->directory_output = DIRECTORY_OUTPUT_PER_FILE;
+        } else if (strcmp(arg, "--no-uring") == 0) {
+            options->use_io_uring = false;
+        } else if (strcmp(arg, "--dedup") == 0) {
+            options->deduplicate = true;
+        } else if (strcmp(arg, "--out") == 0) {
+            if ((options->output_path = take_value(argc, argv, &i)) == NULL) {
+                return ERROR_CODE;
+            }
+        } else if (strcmp(arg, "--format") == 0) {
+            const char* format = take_value(argc, argv, &i);
+            if (format != NULL && strcmp(format, "text") == 0) {
+                options->format = RECORD_TEXT;
+            } else if (format != NULL && strcmp(format, "csv") == 0) {
+                options->format = RECORD_CSV;
+            } else if (format != NULL && strcmp(format, "f32") == 0) {
+                options->packed = true;
+                options->packed_encoding.roots = PACKED_ROOTS_FLOAT32;
+            } else if (format != NULL && strcmp(format, "fixed") == 0) {
+                options->packed = true;
+                options->packed_encoding.roots = PACKED_ROOTS_FIXED32;
+            } else {
+                fprintf(stderr, "Неизвестный формат. Допустимые форматы: text, csv, f32, fixed.\n");
+                return ERROR_CODE;
+            }
+        } else if (strcmp(arg, "--precision") == 0) {
+            const char* precision = take_value(argc, argv, &i);
+            char* end = NULL;
+            unsigned long value = precision != NULL ? strtoul(precision, &end, 10) : 0;
+            if (precision == NULL || end == precision || *end != '\0' || value > PACKED_MAX_PRECISION) {
+                fprintf(stderr, "Точность должна быть целым числом от 0 до %u.\n", PACKED_MAX_PRECISION);
+                return ERROR_CODE;
+            }
+            options->packed_encoding.precision = (unsigned) value;
+        } else if (strcmp(arg, "--decode") == 0) {
+            options->mode = COMMAND_DECODE;
+            if ((options->input_path = take_value(argc, argv, &i)) == NULL) {
+                return ERROR_CODE;
+            }
+        } else if (strcmp(arg, "--follow") == 0) {
+            options->mode = COMMAND_FOLLOW;
+        } else if (strcmp(arg, "--test") == 0) {
+            options->mode = COMMAND_TEST;
+        } else if (strcmp(arg, "--locale") == 0) {
+            setlocale(LC_ALL, "Rus");
+        } else if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            options->mode = COMMAND_HELP;
+            return SUCCESS;
+        } else if (options->mode == COMMAND_FOLLOW && arg[0] != '-') {
+            if (options->num_follow_paths == MAX_FOLLOWED_FILES) {
+                fprintf(stderr, "Слишком много входных файлов, максимум %zu.\n", MAX_FOLLOWED_FILES);
+                return ERROR_CODE;
+            }
+            options->follow_paths[options->num_follow_paths++] = arg;
+        } else {
+            char* end = NULL;
+            strtod(arg, &end);
+            if (end == arg || *end != '\0' || options->num_numbers == 3) {
+                fprintf(stderr, "Неизвестный аргумент: %s\n%s", arg, USAGE);
+                return ERROR_CODE;
+            }
+            options->numbers[options->num_numbers++] = arg;
+            if (options->mode == COMMAND_NONE) {
+                options->mode = COMMAND_SINGLE;
+            }
+        }
+    }
+
+    if (options->mode == COMMAND_SINGLE && options->num_numbers != 3) {
+        fprintf(stderr, "Необходимо указать три коэффициента a, b и c.\n");
+        return ERROR_CODE;
+    }
+    if (options->mode != COMMAND_SINGLE && options->num_numbers != 0) {
+        fprintf(stderr, "Коэффициенты нельзя указывать вместе с --batch, --dir, --follow, --decode или --test.\n");
+        return ERROR_CODE;
+    }
+    if (options->mode == COMMAND_FOLLOW && (options->num_follow_paths == 0 || options->output_path == NULL)) {
+        fprintf(stderr, "Для --follow необходимо указать входные файлы и --out.\n");
+        return ERROR_CODE;
+    }
+    if (options->mode == COMMAND_DIR && options->output_path == NULL) {
+        fprintf(stderr, "Для --dir необходимо указать --out.\n");
+        return ERROR_CODE;
+    }
+    if (options->packed && options->mode != COMMAND_BATCH) {
+        fprintf(stderr, "Упакованный формат поддерживается только с --batch.\n");
+        return ERROR_CODE;
+    }
+    if (options->mode == COMMAND_NONE) {
+        fputs(USAGE, stderr);
+        return ERROR_CODE;
+    }
+    return SUCCESS;
+}
+
+/**
+ * @brief Решает одно уравнение, заданное в командной строке, и печатает запись результата.
+ *
+ * @details
+ * Уравнение решается через @ref solve_square_equations как пакет из одного уравнения, чтобы
+ * результат совпадал с --batch: целые коэффициенты решаются точно, без EPSILON.
+ *
+ * @param[in] options Разобранные аргументы командной строки.
+ * @return SUCCESS при успешной записи результата, иначе ERROR_CODE.
+ */
+static int run_single(const CommandOptions* options) {
+    SquareEquationCoefficient coeffts = {
+        strtod(options->numbers[0], NULL),
+        strtod(options->numbers[1], NULL),
+        strtod(options->numbers[2], NULL)
+    };
+    SquareEquationResult result = {0, 0, NoRoots};
+    solve_square_equations(&coeffts, &result, 1);
+
+    char record[MAX_RECORD_LENGTH] = "";
+    size_t length = format_solution_record(record, options->format, coeffts, result);
+    return fwrite(record, 1, length, stdout) == length ? SUCCESS : ERROR_CODE;
+}
+
+/**
+ * @brief Печатает в stderr статистику исключения повторов.
+ *
+ * @param[in] stats Статистика исключения повторов.
+ */
+static void report_dedup_stats(const DedupStats* stats) {
+    fprintf(stderr, "Уникальных уравнений: %zu из %zu, доля повторов: %.1f%%\n",
+            stats->num_unique, stats->num_equations, 100 * dedup_ratio(stats));
+}
+
+/**
+ * @brief Решает все уравнения входного файла и записывает результаты.
+ *
+ * @param[in] options Разобранные аргументы командной строки.
+ * @return SUCCESS при успехе, иначе ERROR_CODE.
+ */
+static int run_batch(const CommandOptions* options) {
+    bool use_stdin = strcmp(options->input_path, "-") == 0;
+    FILE* input = use_stdin ? stdin : fopen(options->input_path, "rb");
+    if (input == NULL) {
+        fprintf(stderr, "%s: не удалось открыть входной файл.\n", options->input_path);
+        return ERROR_CODE;
+    }
+
+    FILE* output = options->output_path != NULL ? fopen(options->output_path, "wb") : stdout;
+    if (output == NULL) {
+        fprintf(stderr, "%s: не удалось открыть выходной файл.\n", options->output_path);
+        if (!use_stdin) {
+            fclose(input);
+        }
+        return ERROR_CODE;
+    }
+    setvbuf(output, NULL, _IOFBF, OUTPUT_BUFFER_SIZE);
+
+    DedupStats stats = {};
+    BatchOptions batch_options = { options->format, NULL, options->deduplicate ? &stats : NULL,
+                                   options->packed ? &options->packed_encoding : NULL };
+    int status = solve_stream(input, output, &batch_options);
+    if (options->deduplicate) {
+        report_dedup_stats(&stats);
+    }
+
+    if (output != stdout && fclose(output) != 0) {
+        status = ERROR_CODE;
+    }
+    if (!use_stdin) {
+        fclose(input);
+    }
+    return status;
+}
+
+/**
+ * @brief Декодирует упакованный файл результатов и записывает результаты в текстовом виде.
+ *
+ * @details
+ * Каждая запись выводится строкой `type [x1 [x2]]`. Корни файлов с целыми корнями
+ * печатаются с точностью из заголовка файла, корни float32 - с 9 значащими цифрами.
+ * Файл декодируется потоково, по одному блоку.
+ *
+ * @param[in] options Разобранные аргументы командной строки.
+ * @return SUCCESS при успехе, иначе ERROR_CODE.
+ */
+static int run_decode(const CommandOptions* options) {
+    FILE* input = fopen(options->input_path, "rb");
+    if (input == NULL) {
+        fprintf(stderr, "%s: не удалось открыть входной файл.\n", options->input_path);
+        return ERROR_CODE;
+    }
+
+    PackedReader reader = {};
+    if (open_packed_reader(&reader, input) != SUCCESS) {
+        fprintf(stderr, "%s: файл не является упакованным файлом результатов.\n", options->input_path);
+        fclose(input);
+        return ERROR_CODE;
+    }
+
+    FILE* output = options->output_path != NULL ? fopen(options->output_path, "wb") : stdout;
+    if (output == NULL) {
+        fprintf(stderr, "%s: не удалось открыть выходной файл.\n", options->output_path);
+        fclose(input);
+        return ERROR_CODE;
+    }
+    setvbuf(output, NULL, _IOFBF, OUTPUT_BUFFER_SIZE);
+
+    bool is_fixed = reader.encoding.roots == PACKED_ROOTS_FIXED32;
+    const char* root_format = is_fixed ? " %.*f" : " %.*g";
+    int root_precision = is_fixed ? (int) reader.encoding.precision : 9;
+
+    SquareEquationResult results[PACKED_BLOCK_SIZE];
+    size_t count = 0;
+    int status = SUCCESS;
+
+    while ((status = read_packed_block(&reader, results, &count)) == SUCCESS && count > 0) {
+        for (size_t i = 0; i < count; i++) {
+            fprintf(output, "%d", results[i].result_type);
+            if (results[i].result_type == OneRoot || results[i].result_type == TwoRoots) {
+                fprintf(output, root_format, root_precision, results[i].x1);
+            }
+            if (results[i].result_type == TwoRoots) {
+                fprintf(output, root_format, root_precision, results[i].x2);
+            }
+            fputc('\n', output);
+        }
+    }
+    if (status != SUCCESS) {
+        fprintf(stderr, "%s: поврежденный блок упакованного файла.\n", options->input_path);
+    }
+
+    if (output != stdout && fclose(output) != 0) {
+        status = ERROR_CODE;
+    }
+    fclose(input);
+    return status;
+}
+
+/**
+ * @brief Выполняет программу в неинтерактивном режиме по аргументам командной строки.
+ *
+ * @details
+ * Функция разбирает аргументы и запускает выбранное действие. При ошибке в аргументах
+ * печатается справка.
+ *
+ * @param[in] argc Количество аргументов командной строки.
+ * @param[in] argv Аргументы командной строки.
+ * @return SUCCESS при успешном выполнении, иначе ERROR_CODE.
+ */
+int run_command_line(int argc, char* argv[]) {
+    assert(argv != NULL);
+
+    CommandOptions options = {};
+    options.mode = COMMAND_NONE;
+    options.format = RECORD_TEXT;
+    options.directory_output = DIRECTORY_OUTPUT_COMBINED;
+    options.use_io_uring = true;
+    options.packed_encoding.roots = PACKED_ROOTS_FLOAT32;
+    options.packed_encoding.precision = 2;
+
+    if (parse_arguments(argc, argv, &options) != SUCCESS) {
+        return ERROR_CODE;
+    }
+
+    switch (options.mode) {
+        case COMMAND_SINGLE:
+            return run_single(&options);
+
+        case COMMAND_BATCH:
+            return run_batch(&options);
+
+        case COMMAND_DIR: {
+            DedupStats stats = {};
+            DirectoryOptions directory_options = { options.directory_output, options.format, options.use_io_uring,
+                                                   options.deduplicate ? &stats : NULL };
+            int status = solve_directory(options.input_path, options.output_path, &directory_options);
+            if (options.deduplicate) {
+                report_dedup_stats(&stats);
+            }
+            return status;
+        }
+
+        case COMMAND_DECODE:
+            return run_decode(&options);
+
+        case COMMAND_FOLLOW:
+            return follow_files(options.follow_paths, options.num_follow_paths, options.output_path);
+
+        case COMMAND_TEST:
+            run_tests();
+            return SUCCESS;
+
+        case COMMAND_HELP:
+            fputs(USAGE, stdout);
+            return SUCCESS;
+
+        default:
+            return ERROR_CODE;
+    }
+}
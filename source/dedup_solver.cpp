@@ -0,0 +1,225 @@
+/**
+ * @file dedup_solver.cpp
+ * @brief Пакетное решение уравнений с исключением повторов.
+ *
+ * @details
+ * Пакет обрабатывается блоками по DEDUP_BLOCK_SIZE уравнений. Для каждого блока:
+ * 1. Вычисляются хеши троек коэффициентов.
+ * 2. Индексы уравнений раскладываются по DEDUP_PARTITIONS частям по старшим битам хеша
+ *    (поразрядное разбиение), так что каждая часть ищется в собственной небольшой
+ *    хеш-таблице, которая целиком помещается в кэш L1.
+ * 3. В таблице части с открытой адресацией находится номер уникальной тройки
+ *    (коэффициенты сравниваются только при совпадении полных хешей),
+ *    новая тройка добавляется в массив уникальных.
+ * 4. Уникальные тройки решаются @ref solve_square_equations, результаты раскладываются
+ *    по исходным позициям.
+ *
+ * Все рабочие массивы размещаются на стеке.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "dedup_solver.h"
+#include "solver.h"
+
+/**
+ * @brief Количество старших бит хеша, по которым уравнения разбиваются на части.
+ */
+const unsigned DEDUP_RADIX_BITS = 4;
+
+/**
+ * @brief Количество частей, на которые разбивается блок.
+ */
+const size_t DEDUP_PARTITIONS = (size_t) 1 << DEDUP_RADIX_BITS;
+
+/**
+ * @brief Размер общей памяти хеш-таблиц частей, не менее удвоенного размера блока.
+ */
+const size_t DEDUP_TABLE_SIZE = 2 * DEDUP_BLOCK_SIZE;
+
+static_assert(DEDUP_BLOCK_SIZE < UINT16_MAX, "Номера уравнений блока должны помещаться в uint16_t");
+
+/**
+ * @brief Перемешивает биты 64-битного числа (финализатор MurmurHash3).
+ *
+ * @param[in] value Исходное число.
+ * @return Перемешанное число.
+ */
+static inline uint64_t mix_bits(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+/**
+ * @brief Вычисляет хеш тройки коэффициентов по их битовому представлению.
+ *
+ * @param[in] coeffts Коэффициенты уравнения.
+ * @return Хеш коэффициентов.
+ */
+static inline uint64_t hash_coefficients(const SquareEquationCoefficient* coeffts) {
+    uint64_t bits[3] = {};
+    memcpy(bits, coeffts, sizeof(bits));
+    return mix_bits(bits[0] * 0x9e3779b97f4a7c15ULL + bits[1] * 0xbf58476d1ce4e5b9ULL + bits[2]);
+}
+
+/**
+ * @brief Проверяет побитовое совпадение двух троек коэффициентов.
+ *
+ * @param[in] first  Первая тройка.
+ * @param[in] second Вторая тройка.
+ * @return true, если тройки совпадают.
+ */
+static inline bool same_coefficients(const SquareEquationCoefficient* first, const SquareEquationCoefficient* second) {
+    uint64_t first_bits[3] = {};
+    uint64_t second_bits[3] = {};
+    memcpy(first_bits, first, sizeof(first_bits));
+    memcpy(second_bits, second, sizeof(second_bits));
+    return ((first_bits[0] ^ second_bits[0]) | (first_bits[1] ^ second_bits[1]) | (first_bits[2] ^ second_bits[2])) == 0;
+}
+
+/**
+ * @brief Возвращает наименьшую степень двойки, не меньшую удвоенного количества элементов.
+ *
+ * @param[in] count Количество элементов.
+ * @return Размер хеш-таблицы.
+ */
+static inline size_t table_size_for(size_t count) {
+    size_t size = 2;
+    while (size < 2 * count) {
+        size *= 2;
+    }
+    return size;
+}
+
+/**
+ * @brief Решает блок не более чем из DEDUP_BLOCK_SIZE уравнений, исключая повторы.
+ *
+ * @param[in]  coeffts Массив коэффициентов блока.
+ * @param[out] results Массив результатов блока.
+ * @param[in]  count   Количество уравнений в блоке.
+ * @return Количество уникальных уравнений блока.
+ */
+static size_t solve_block_dedup(const SquareEquationCoefficient* coeffts, SquareEquationResult* results, size_t count) {
+    assert(count <= DEDUP_BLOCK_SIZE);
+
+    uint64_t hashes[DEDUP_BLOCK_SIZE];
+    uint16_t order[DEDUP_BLOCK_SIZE];
+    uint16_t unique_of[DEDUP_BLOCK_SIZE];
+    uint16_t table[DEDUP_TABLE_SIZE];
+    size_t partition_start[DEDUP_PARTITIONS + 1] = {};
+    size_t partition_end[DEDUP_PARTITIONS] = {};
+    uint64_t unique_hashes[DEDUP_BLOCK_SIZE];
+    SquareEquationCoefficient unique_coeffts[DEDUP_BLOCK_SIZE];
+    SquareEquationResult unique_results[DEDUP_BLOCK_SIZE];
+
+    for (size_t i = 0; i < count; i++) {
+        hashes[i] = hash_coefficients(&coeffts[i]);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        partition_start[(hashes[i] >> (64 - DEDUP_RADIX_BITS)) + 1]++;
+    }
+    for (size_t part = 0; part < DEDUP_PARTITIONS; part++) {
+        partition_start[part + 1] += partition_start[part];
+        partition_end[part] = partition_start[part];
+    }
+    for (size_t i = 0; i < count; i++) {
+        order[partition_end[hashes[i] >> (64 - DEDUP_RADIX_BITS)]++] = (uint16_t) i;
+    }
+
+    size_t num_unique = 0;
+    for (size_t part = 0; part < DEDUP_PARTITIONS; part++) {
+        size_t part_size = partition_end[part] - partition_start[part];
+        if (part_size == 0) {
+            continue;
+        }
+
+        size_t mask = table_size_for(part_size) - 1;
+        memset(table, 0, (mask + 1) * sizeof(table[0]));
+
+        for (size_t k = partition_start[part]; k < partition_end[part]; k++) {
+            size_t i = order[k];
+            size_t slot = hashes[i] & mask;
+
+            while (table[slot] != 0 && (unique_hashes[table[slot] - 1] != hashes[i] ||
+                                        !same_coefficients(&unique_coeffts[table[slot] - 1], &coeffts[i]))) {
+                slot = (slot + 1) & mask;
+            }
+            if (table[slot] == 0) {
+                unique_hashes[num_unique] = hashes[i];
+                unique_coeffts[num_unique] = coeffts[i];
+                table[slot] = (uint16_t) ++num_unique;
+            }
+            unique_of[i] = (uint16_t) (table[slot] - 1);
+        }
+    }
+
+    solve_square_equations(unique_coeffts, unique_results, num_unique);
+
+    for (size_t i = 0; i < count; i++) {
+        results[i] = unique_results[unique_of[i]];
+    }
+    return num_unique;
+}
+
+/**
+ * @brief Решает пакет квадратных уравнений, решая каждую уникальную тройку коэффициентов один раз.
+ *
+ * @param[in]     coeffts Массив коэффициентов уравнений.
+ * @param[out]    results Массив для результатов, размером не менее count.
+ * @param[in]     count   Количество уравнений в пакете.
+ * @param[in,out] stats   Статистика, к которой добавляются данные пакета, или NULL.
+ */
+void solve_square_equations_dedup(const SquareEquationCoefficient* coeffts, SquareEquationResult* results,
+                                  size_t count, DedupStats* stats) {
+    assert(coeffts != NULL || count == 0);
+    assert(results != NULL || count == 0);
+
+    size_t num_unique = 0;
+    for (size_t start = 0; start < count; start += DEDUP_BLOCK_SIZE) {
+        size_t block_size = count - start < DEDUP_BLOCK_SIZE ? count - start : DEDUP_BLOCK_SIZE;
+        num_unique += solve_block_dedup(coeffts + start, results + start, block_size);
+    }
+
+    if (stats != NULL) {
+        stats->num_equations += count;
+        stats->num_unique += num_unique;
+    }
+}
+
+/**
+ * @brief Добавляет статистику одного прохода к другой.
+ *
+ * @param[in,out] total Общая статистика.
+ * @param[in]     part  Добавляемая статистика.
+ */
+void merge_dedup_stats(DedupStats* total, const DedupStats* part) {
+    assert(total != NULL);
+    assert(part != NULL);
+
+    total->num_equations += part->num_equations;
+    total->num_unique += part->num_unique;
+}
+
+/**
+ * @brief Вычисляет долю повторов.
+ *
+ * @param[in] stats Статистика.
+ * @return Доля уравнений, не потребовавших решения, от 0 до 1.
+ */
+double dedup_ratio(const DedupStats* stats) {
+    assert(stats != NULL);
+
+    if (stats->num_equations == 0) {
+        return 0;
+    }
+    return 1 - (double) stats->num_unique / (double) stats->num_equations;
+}
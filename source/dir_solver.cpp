@@ -0,0 +1,1181 @@
+/**
+ * @file dir_solver.cpp
+ * @brief Пакетное решение уравнений из каталога с множеством небольших файлов.
+ *
+ * @details
+ * Этот файл содержит две реализации обработки каталога.
+ *
+ * Основная реализация для Linux работает с io_uring напрямую через системные вызовы, без liburing.
+ * Каждый файл проходит цепочку операций openat - read - close, затем его данные разбираются
+ * и решаются @ref solve_lines, а результат записывается операциями openat - write - close
+ * (или одной операцией write в общий файл). Одновременно обрабатывается до DIRECTORY_QUEUE_DEPTH
+ * файлов, и у каждого в очереди находится не более одной операции.
+ *
+ * Запасная реализация используется, если ядро не поддерживает io_uring или нужные операции
+ * (openat, read, write и close появились в ядре 5.6): файлы обрабатываются пулом потоков,
+ * которые читают их через pread.
+ *
+ * Список файлов составляется через opendir/readdir, а потоки запускаются через POSIX threads
+ * (в MinGW - winpthreads): std::filesystem и std::thread потребовали бы загрузки libstdc++
+ * при каждом запуске программы, в том числе для решения одного уравнения.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <atomic>
+#include "dir_solver.h"
+#include "batch_solver.h"
+#include "error_code.h"
+#include "processor_count.h"
+
+#ifdef _WIN32
+#include <io.h>
+#include <direct.h>
+#else
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#define DIR_SOLVER_HAVE_IO_URING
+#endif
+
+/**
+ * @brief Начальный размер буфера чтения одного файла.
+ */
+const size_t DIRECTORY_READ_SIZE = 64 * 1024;
+
+/**
+ * @struct DirectoryFiles
+ * @brief Структура для хранения списка обрабатываемых файлов.
+ */
+struct DirectoryFiles {
+    char** names;        /**< Имена входных файлов, используемые в тегах записей. */
+    char** input_paths;  /**< Полные пути к входным файлам. */
+    char** output_paths; /**< Пути к выходным файлам (только при DIRECTORY_OUTPUT_PER_FILE). */
+    size_t count;        /**< Количество файлов. */
+    size_t capacity;     /**< Размер массивов списка. */
+};
+
+/**
+ * @brief Составляет путь к файлу каталога.
+ *
+ * @param[in] dir  Путь к каталогу.
+ * @param[in] name Имя файла.
+ * @return Строка в динамической памяти или NULL при нехватке памяти.
+ */
+static char* join_path(const char* dir, const char* name) {
+    size_t dir_length = strlen(dir);
+    size_t name_length = strlen(name);
+    bool has_separator = dir_length > 0 && (dir[dir_length - 1] == '/' || dir[dir_length - 1] == '\\');
+
+    char* path = (char*) malloc(dir_length + name_length + 2);
+    if (path != NULL) {
+        memcpy(path, dir, dir_length);
+        if (!has_separator) {
+            path[dir_length++] = '/';
+        }
+        memcpy(path + dir_length, name, name_length + 1);
+    }
+    return path;
+}
+
+/**
+ * @brief Освобождает память списка файлов.
+ *
+ * @param[in,out] files Список файлов.
+ */
+static void free_directory_files(DirectoryFiles* files) {
+    for (size_t i = 0; i < files->count; i++) {
+        free(files->names[i]);
+        free(files->input_paths[i]);
+        if (files->output_paths != NULL) {
+            free(files->output_paths[i]);
+        }
+    }
+    free(files->names);
+    free(files->input_paths);
+    free(files->output_paths);
+    memset(files, 0, sizeof(*files));
+}
+
+/**
+ * @brief Добавляет файл в список.
+ *
+ * @param[in,out] files      Список файлов.
+ * @param[in]     name       Имя файла.
+ * @param[in]     input_path Полный путь к входному файлу, владение передается списку.
+ * @param[in]     output_dir Выходной каталог или NULL.
+ * @return SUCCESS при успехе, ERROR_CODE при нехватке памяти.
+ */
+static int add_directory_file(DirectoryFiles* files, const char* name, char* input_path, const char* output_dir) {
+    if (files->count == files->capacity) {
+        size_t capacity = files->capacity == 0 ? 64 : files->capacity * 2;
+        char** names = (char**) realloc(files->names, capacity * sizeof(char*));
+        if (names != NULL) {
+            files->names = names;
+        }
+        char** input_paths = (char**) realloc(files->input_paths, capacity * sizeof(char*));
+        if (input_paths != NULL) {
+            files->input_paths = input_paths;
+        }
+        char** output_paths = output_dir == NULL ? NULL : (char**) realloc(files->output_paths, capacity * sizeof(char*));
+        if (output_paths != NULL) {
+            files->output_paths = output_paths;
+        }
+        if (names == NULL || input_paths == NULL || (output_dir != NULL && output_paths == NULL)) {
+            free(input_path);
+            return ERROR_CODE;
+        }
+        files->capacity = capacity;
+    }
+
+    char* name_copy = (char*) malloc(strlen(name) + 1);
+    char* output_path = output_dir != NULL ? join_path(output_dir, name) : NULL;
+    if (name_copy == NULL || (output_dir != NULL && output_path == NULL)) {
+        free(name_copy);
+        free(output_path);
+        free(input_path);
+        return ERROR_CODE;
+    }
+    strcpy(name_copy, name);
+
+    files->names[files->count] = name_copy;
+    files->input_paths[files->count] = input_path;
+    if (output_dir != NULL) {
+        files->output_paths[files->count] = output_path;
+    }
+    files->count++;
+    return SUCCESS;
+}
+
+/**
+ * @brief Создает каталог вместе с недостающими родительскими каталогами.
+ *
+ * @param[in] path Путь к каталогу.
+ * @return SUCCESS, если каталог существует или создан, иначе ERROR_CODE.
+ */
+static int make_directories(const char* path) {
+    char partial[FILENAME_MAX] = "";
+    size_t length = strlen(path);
+    if (length >= FILENAME_MAX) {
+        return ERROR_CODE;
+    }
+
+    for (size_t i = 1; i <= length; i++) {
+        if (path[i] != '/' && path[i] != '\\' && path[i] != '\0') {
+            continue;
+        }
+        memcpy(partial, path, i);
+        partial[i] = '\0';
+#ifdef _WIN32
+        _mkdir(partial);
+#else
+        mkdir(partial, 0755);
+#endif
+    }
+
+    struct stat dir_stat;
+    return stat(path, &dir_stat) == 0 && S_ISDIR(dir_stat.st_mode) ? SUCCESS : ERROR_CODE;
+}
+
+/**
+ * @brief Проверяет, указывают ли два пути на один и тот же каталог.
+ *
+ * @param[in] first  Первый путь.
+ * @param[in] second Второй путь.
+ * @return true, если пути указывают на один каталог.
+ */
+static bool is_same_directory(const char* first, const char* second) {
+#ifdef _WIN32
+    char first_full[FILENAME_MAX] = "";
+    char second_full[FILENAME_MAX] = "";
+    return _fullpath(first_full, first, FILENAME_MAX) != NULL &&
+           _fullpath(second_full, second, FILENAME_MAX) != NULL &&
+           _stricmp(first_full, second_full) == 0;
+#else
+    struct stat first_stat;
+    struct stat second_stat;
+    return stat(first, &first_stat) == 0 && stat(second, &second_stat) == 0 &&
+           first_stat.st_dev == second_stat.st_dev && first_stat.st_ino == second_stat.st_ino;
+#endif
+}
+
+/**
+ * @brief Составляет список обычных файлов входного каталога и пути к выходным файлам.
+ *
+ * @param[in]  input_dir   Путь к входному каталогу.
+ * @param[in]  output_path Путь к общему выходному файлу или к выходному каталогу.
+ * @param[in]  options     Параметры обработки.
+ * @param[out] files       Список файлов.
+ * @return SUCCESS при успехе, иначе ERROR_CODE.
+ */
+static int list_directory(const char* input_dir, const char* output_path,
+                          const DirectoryOptions* options, DirectoryFiles* files) {
+    const char* output_dir = options->output == DIRECTORY_OUTPUT_PER_FILE ? output_path : NULL;
+    if (output_dir != NULL && (make_directories(output_dir) != SUCCESS || is_same_directory(input_dir, output_dir))) {
+        fprintf(stderr, "%s: выходной каталог недоступен или совпадает с входным.\n", output_path);
+        return ERROR_CODE;
+    }
+
+    DIR* dir = opendir(input_dir);
+    if (dir == NULL) {
+        fprintf(stderr, "%s: не удалось открыть входной каталог.\n", input_dir);
+        return ERROR_CODE;
+    }
+
+    int status = SUCCESS;
+    struct dirent* entry = NULL;
+    while (status == SUCCESS && (entry = readdir(dir)) != NULL) {
+        char* input_path = join_path(input_dir, entry->d_name);
+        struct stat file_stat;
+        if (input_path != NULL && (stat(input_path, &file_stat) != 0 || !S_ISREG(file_stat.st_mode))) {
+            free(input_path);
+            continue;
+        }
+        if (input_path == NULL || add_directory_file(files, entry->d_name, input_path, output_dir) != SUCCESS) {
+            fprintf(stderr, "Недостаточно памяти для списка файлов.\n");
+            status = ERROR_CODE;
+        }
+    }
+    closedir(dir);
+    return status;
+}
+
+/**
+ * @brief Решает уравнения прочитанного файла и форматирует результаты.
+ *
+ * @param[in]     data    Содержимое файла.
+ * @param[in]     size    Размер содержимого.
+ * @param[in]     name    Имя файла для тега записей или NULL.
+ * @param[in]     options Параметры обработки.
+ * @param[in,out] stats   Статистика исключения повторов или NULL.
+ * @param[in,out] output  Выходной буфер.
+ * @return SUCCESS при успехе, ERROR_CODE при нехватке памяти для результатов.
+ */
+static int solve_file_data(const char* data, size_t size, const char* name,
+                           const DirectoryOptions* options, DedupStats* stats, OutputBuffer* output) {
+    if (options->output == DIRECTORY_OUTPUT_PER_FILE && options->format == RECORD_CSV &&
+        append_output(output, CSV_HEADER, strlen(CSV_HEADER)) != SUCCESS) {
+        return ERROR_CODE;
+    }
+
+    BatchOptions batch_options = { options->format, name, stats, NULL };
+    size_t consumed = 0;
+    return solve_lines(data, size, true, &batch_options, output, &consumed);
+}
+
+/**
+ * @brief Возвращает заголовок общего выходного файла.
+ *
+ * @param[in] options Параметры обработки.
+ * @return Заголовок или пустая строка.
+ */
+static const char* combined_header(const DirectoryOptions* options) {
+    return options->format == RECORD_CSV ? CSV_FILE_HEADER : "";
+}
+
+#ifdef DIR_SOLVER_HAVE_IO_URING
+
+/**
+ * @struct IoRing
+ * @brief Структура для хранения отображенных в память очередей io_uring.
+ */
+struct IoRing {
+    int fd;                   /**< Дескриптор io_uring. */
+    unsigned* sq_head;        /**< Голова очереди отправки. */
+    unsigned* sq_tail;        /**< Хвост очереди отправки. */
+    unsigned* sq_mask;        /**< Маска индексов очереди отправки. */
+    unsigned* sq_array;       /**< Массив индексов SQE очереди отправки. */
+    io_uring_sqe* sqes;       /**< Массив SQE. */
+    unsigned* cq_head;        /**< Голова очереди завершения. */
+    unsigned* cq_tail;        /**< Хвост очереди завершения. */
+    unsigned* cq_mask;        /**< Маска индексов очереди завершения. */
+    io_uring_cqe* cqes;       /**< Массив CQE. */
+    void* sq_ring;            /**< Отображение очереди отправки. */
+    size_t sq_ring_size;      /**< Размер отображения очереди отправки. */
+    void* cq_ring;            /**< Отображение очереди завершения. */
+    size_t cq_ring_size;      /**< Размер отображения очереди завершения. */
+    size_t sqes_size;         /**< Размер отображения массива SQE. */
+    unsigned to_submit;       /**< Количество подготовленных, но не отправленных SQE. */
+};
+
+/**
+ * @brief Проверяет, поддерживает ли ядро операции io_uring, необходимые для обработки каталога.
+ *
+ * @param[in] ring_fd Дескриптор io_uring.
+ * @return true, если поддерживаются openat, read, write и close, иначе false.
+ */
+static bool ring_supports_operations(int ring_fd) {
+    const unsigned NUM_PROBE_OPS = 256;
+    size_t probe_size = sizeof(io_uring_probe) + NUM_PROBE_OPS * sizeof(io_uring_probe_op);
+    io_uring_probe* probe = (io_uring_probe*) calloc(1, probe_size);
+    if (probe == NULL) {
+        return false;
+    }
+
+    bool supported = false;
+    if (syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_PROBE, probe, NUM_PROBE_OPS) == 0) {
+        const int required_ops[] = { IORING_OP_OPENAT, IORING_OP_READ, IORING_OP_WRITE, IORING_OP_CLOSE };
+        supported = true;
+        for (size_t i = 0; i < sizeof(required_ops) / sizeof(required_ops[0]); i++) {
+            int op = required_ops[i];
+            if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+                supported = false;
+            }
+        }
+    }
+
+    free(probe);
+    return supported;
+}
+
+/**
+ * @brief Освобождает очереди io_uring.
+ *
+ * @param[in,out] ring Очереди io_uring.
+ */
+static void ring_free(IoRing* ring) {
+    if (ring->sqes != NULL && ring->sqes != MAP_FAILED) {
+        munmap(ring->sqes, ring->sqes_size);
+    }
+    if (ring->cq_ring != NULL && ring->cq_ring != MAP_FAILED && ring->cq_ring != ring->sq_ring) {
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    }
+    if (ring->sq_ring != NULL && ring->sq_ring != MAP_FAILED) {
+        munmap(ring->sq_ring, ring->sq_ring_size);
+    }
+    if (ring->fd >= 0) {
+        close(ring->fd);
+    }
+    memset(ring, 0, sizeof(*ring));
+    ring->fd = -1;
+}
+
+/**
+ * @brief Создает io_uring и отображает его очереди в память.
+ *
+ * @param[out] ring    Очереди io_uring.
+ * @param[in]  entries Размер очереди отправки.
+ * @return SUCCESS, если io_uring создан и поддерживает нужные операции, иначе ERROR_CODE.
+ */
+static int ring_init(IoRing* ring, unsigned entries) {
+    memset(ring, 0, sizeof(*ring));
+    ring->fd = -1;
+
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ring->fd = (int) syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->fd < 0 || !ring_supports_operations(ring->fd)) {
+        ring_free(ring);
+        return ERROR_CODE;
+    }
+
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap && ring->cq_ring_size > ring->sq_ring_size) {
+        ring->sq_ring_size = ring->cq_ring_size;
+    }
+
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED) {
+        ring_free(ring);
+        return ERROR_CODE;
+    }
+
+    ring->cq_ring = single_mmap ? ring->sq_ring
+                                : mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+                                       MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+    ring->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    ring->sqes = (io_uring_sqe*) mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                                      MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (ring->cq_ring == MAP_FAILED || ring->sqes == MAP_FAILED) {
+        ring_free(ring);
+        return ERROR_CODE;
+    }
+
+    char* sq = (char*) ring->sq_ring;
+    char* cq = (char*) ring->cq_ring;
+    ring->sq_head = (unsigned*) (sq + params.sq_off.head);
+    ring->sq_tail = (unsigned*) (sq + params.sq_off.tail);
+    ring->sq_mask = (unsigned*) (sq + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned*) (sq + params.sq_off.array);
+    ring->cq_head = (unsigned*) (cq + params.cq_off.head);
+    ring->cq_tail = (unsigned*) (cq + params.cq_off.tail);
+    ring->cq_mask = (unsigned*) (cq + params.cq_off.ring_mask);
+    ring->cqes = (io_uring_cqe*) (cq + params.cq_off.cqes);
+    return SUCCESS;
+}
+
+/**
+ * @brief Подготавливает SQE в очереди отправки.
+ *
+ * @details
+ * Вызывающий код гарантирует, что в очереди есть место: у каждого файла в очереди
+ * не более одной операции, а файлов не больше размера очереди.
+ *
+ * @param[in,out] ring      Очереди io_uring.
+ * @param[in]     opcode    Код операции IORING_OP_*.
+ * @param[in]     fd        Дескриптор файла операции.
+ * @param[in]     addr      Адрес буфера или пути.
+ * @param[in]     len       Длина буфера или режим создания файла для openat.
+ * @param[in]     offset    Смещение в файле или флаги открытия для openat.
+ * @param[in]     user_data Номер задания, которому принадлежит операция.
+ */
+static void ring_prepare(IoRing* ring, int opcode, int fd, const void* addr, unsigned len,
+                         unsigned long long offset, unsigned long long user_data) {
+    unsigned tail = *ring->sq_tail;
+    unsigned index = tail & *ring->sq_mask;
+    io_uring_sqe* sqe = &ring->sqes[index];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = (unsigned char) opcode;
+    sqe->fd = fd;
+    sqe->addr = (unsigned long long) (uintptr_t) addr;
+    sqe->len = len;
+    if (opcode == IORING_OP_OPENAT) {
+        sqe->open_flags = (unsigned) offset;
+    } else {
+        sqe->off = offset;
+    }
+    sqe->user_data = user_data;
+
+    ring->sq_array[index] = index;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ring->to_submit++;
+}
+
+/**
+ * @brief Отправляет подготовленные SQE и ожидает хотя бы одного завершения.
+ *
+ * @param[in,out] ring Очереди io_uring.
+ * @return SUCCESS при успехе, иначе ERROR_CODE.
+ */
+static int ring_submit_and_wait(IoRing* ring) {
+    for (;;) {
+        long submitted = syscall(__NR_io_uring_enter, ring->fd, ring->to_submit, 1,
+                                 IORING_ENTER_GETEVENTS, NULL, 0);
+        if (submitted >= 0) {
+            ring->to_submit -= (unsigned) submitted;
+            return SUCCESS;
+        }
+        if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            return ERROR_CODE;
+        }
+    }
+}
+
+/**
+ * @brief Извлекает очередное завершение из очереди завершения.
+ *
+ * @param[in,out] ring Очереди io_uring.
+ * @param[out]    cqe  Копия завершения.
+ * @return true, если завершение извлечено, false, если очередь пуста.
+ */
+static bool ring_pop_completion(IoRing* ring, io_uring_cqe* cqe) {
+    unsigned head = *ring->cq_head;
+    if (head == __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+
+    *cqe = ring->cqes[head & *ring->cq_mask];
+    __atomic_store_n(ring->cq_head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @enum JobState
+ * @brief Перечисление этапов обработки одного файла через io_uring.
+ */
+enum JobState {
+    JOB_FREE,         /**< Задание свободно. */
+    JOB_OPEN_INPUT,   /**< Открытие входного файла. */
+    JOB_READ,         /**< Чтение входного файла. */
+    JOB_CLOSE_INPUT,  /**< Закрытие входного файла. */
+    JOB_OPEN_OUTPUT,  /**< Открытие выходного файла. */
+    JOB_WAIT_OUTPUT,  /**< Ожидание завершения записи другого задания в общий файл. */
+    JOB_WRITE,        /**< Запись результатов. */
+    JOB_CLOSE_OUTPUT  /**< Закрытие выходного файла. */
+};
+
+/**
+ * @struct DirectoryJob
+ * @brief Структура для хранения состояния обработки одного файла через io_uring.
+ *
+ * @details
+ * Буферы задания сохраняются между файлами, поэтому память выделяется только
+ * при появлении файла больше обработанных ранее.
+ */
+struct DirectoryJob {
+    JobState state;           /**< Текущий этап обработки. */
+    bool failed;              /**< Произошла ли ошибка при обработке текущего файла. */
+    size_t file_index;        /**< Номер обрабатываемого файла. */
+    int fd;                   /**< Дескриптор открытого файла. */
+    char* input;              /**< Буфер содержимого входного файла. */
+    size_t input_size;        /**< Количество прочитанных байт. */
+    size_t input_capacity;    /**< Размер буфера входного файла. */
+    OutputBuffer output;      /**< Отформатированные результаты. */
+    size_t written;           /**< Количество записанных байт результатов. */
+    unsigned long long write_offset; /**< Смещение записи результатов в выходном файле. */
+};
+
+/**
+ * @struct UringDirectory
+ * @brief Структура для хранения общего состояния обработки каталога через io_uring.
+ */
+struct UringDirectory {
+    IoRing ring;                     /**< Очереди io_uring. */
+    const DirectoryFiles* files;     /**< Список файлов. */
+    const DirectoryOptions* options; /**< Параметры обработки. */
+    size_t next_file;                /**< Номер следующего необработанного файла. */
+    size_t active_jobs;              /**< Количество заданий, обрабатывающих файлы. */
+    DirectoryJob* jobs;              /**< Массив DIRECTORY_QUEUE_DEPTH заданий. */
+    int combined_fd;                 /**< Дескриптор общего выходного файла или -1. */
+    unsigned long long combined_offset; /**< Смещение конца полностью записанных данных общего файла. */
+    bool combined_busy;              /**< Выполняется ли запись в общий файл. */
+    size_t failed_files;             /**< Количество файлов, обработанных с ошибкой. */
+};
+
+/**
+ * @brief Начинает обработку следующего файла в задании или освобождает задание.
+ *
+ * @param[in,out] dir    Состояние обработки каталога.
+ * @param[in,out] job    Задание.
+ * @param[in]     job_id Номер задания.
+ */
+static void start_next_file(UringDirectory* dir, DirectoryJob* job, size_t job_id) {
+    if (dir->next_file == dir->files->count) {
+        job->state = JOB_FREE;
+        dir->active_jobs--;
+        return;
+    }
+
+    job->file_index = dir->next_file++;
+    job->failed = false;
+    job->input_size = 0;
+    job->output.size = 0;
+    job->written = 0;
+    job->state = JOB_OPEN_INPUT;
+    ring_prepare(&dir->ring, IORING_OP_OPENAT, AT_FDCWD, dir->files->input_paths[job->file_index],
+                 0, O_RDONLY | O_CLOEXEC, job_id);
+}
+
+/**
+ * @brief Отправляет запись оставшейся части результатов задания.
+ *
+ * @param[in,out] dir    Состояние обработки каталога.
+ * @param[in,out] job    Задание.
+ * @param[in]     job_id Номер задания.
+ */
+static void write_job_output(UringDirectory* dir, DirectoryJob* job, size_t job_id) {
+    job->state = JOB_WRITE;
+    ring_prepare(&dir->ring, IORING_OP_WRITE, job->fd, job->output.data + job->written,
+                 (unsigned) (job->output.size - job->written), job->write_offset + job->written, job_id);
+}
+
+/**
+ * @brief Начинает запись результатов задания в конец общего выходного файла.
+ *
+ * @details
+ * В общий файл одновременно пишет только одно задание, а смещение конца данных сдвигается
+ * только после полной записи результатов. Поэтому при ошибке записи в файле не остается
+ * промежутка из нулевых байт: результаты следующего файла записываются поверх неполной записи.
+ *
+ * @param[in,out] dir    Состояние обработки каталога.
+ * @param[in,out] job    Задание.
+ * @param[in]     job_id Номер задания.
+ */
+static void start_combined_write(UringDirectory* dir, DirectoryJob* job, size_t job_id) {
+    dir->combined_busy = true;
+    job->fd = dir->combined_fd;
+    job->write_offset = dir->combined_offset;
+    write_job_output(dir, job, job_id);
+}
+
+/**
+ * @brief Завершает запись задания в общий файл и передает файл следующему ожидающему заданию.
+ *
+ * @param[in,out] dir       Состояние обработки каталога.
+ * @param[in]     job       Задание, которое закончило запись.
+ * @param[in]     completed Записаны ли результаты задания полностью.
+ */
+static void finish_combined_write(UringDirectory* dir, const DirectoryJob* job, bool completed) {
+    if (completed) {
+        dir->combined_offset = job->write_offset + job->written;
+    }
+    dir->combined_busy = false;
+
+    for (size_t i = 0; i < DIRECTORY_QUEUE_DEPTH; i++) {
+        if (dir->jobs[i].state == JOB_WAIT_OUTPUT) {
+            start_combined_write(dir, &dir->jobs[i], i);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Переводит задание к записи результатов после закрытия входного файла.
+ *
+ * @param[in,out] dir    Состояние обработки каталога.
+ * @param[in,out] job    Задание.
+ * @param[in]     job_id Номер задания.
+ */
+static void start_output(UringDirectory* dir, DirectoryJob* job, size_t job_id) {
+    if (dir->options->output == DIRECTORY_OUTPUT_PER_FILE) {
+        job->state = JOB_OPEN_OUTPUT;
+        ring_prepare(&dir->ring, IORING_OP_OPENAT, AT_FDCWD, dir->files->output_paths[job->file_index],
+                     0644, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, job_id);
+    } else if (job->output.size == 0) {
+        start_next_file(dir, job, job_id);
+    } else if (dir->combined_busy) {
+        job->state = JOB_WAIT_OUTPUT;
+    } else {
+        start_combined_write(dir, job, job_id);
+    }
+}
+
+/**
+ * @brief Обрабатывает завершение операции задания и отправляет следующую операцию.
+ *
+ * @param[in,out] dir    Состояние обработки каталога.
+ * @param[in,out] job    Задание.
+ * @param[in]     job_id Номер задания.
+ * @param[in]     res    Результат операции.
+ */
+static void handle_completion(UringDirectory* dir, DirectoryJob* job, size_t job_id, int res) {
+    const char* name = dir->files->names[job->file_index];
+
+    if (res < 0 && job->state != JOB_CLOSE_INPUT && job->state != JOB_CLOSE_OUTPUT) {
+        fprintf(stderr, "%s: ошибка ввода-вывода: %s\n", name, strerror(-res));
+        dir->failed_files++;
+        job->failed = true;
+
+        if (job->state == JOB_READ) {
+            job->state = JOB_CLOSE_INPUT;
+            ring_prepare(&dir->ring, IORING_OP_CLOSE, job->fd, NULL, 0, 0, job_id);
+        } else if (job->state == JOB_WRITE && job->fd != dir->combined_fd) {
+            job->state = JOB_CLOSE_OUTPUT;
+            ring_prepare(&dir->ring, IORING_OP_CLOSE, job->fd, NULL, 0, 0, job_id);
+        } else {
+            if (job->state == JOB_WRITE) {
+                finish_combined_write(dir, job, false);
+            }
+            start_next_file(dir, job, job_id);
+        }
+        return;
+    }
+
+    switch (job->state) {
+        case JOB_OPEN_INPUT:
+            job->fd = res;
+            job->state = JOB_READ;
+            if (job->input_capacity == 0) {
+                job->input = (char*) malloc(DIRECTORY_READ_SIZE);
+                job->input_capacity = job->input != NULL ? DIRECTORY_READ_SIZE : 0;
+            }
+            if (job->input_capacity == 0) {
+                fprintf(stderr, "%s: недостаточно памяти для чтения файла.\n", name);
+                dir->failed_files++;
+                job->failed = true;
+                job->state = JOB_CLOSE_INPUT;
+                ring_prepare(&dir->ring, IORING_OP_CLOSE, job->fd, NULL, 0, 0, job_id);
+                break;
+            }
+            ring_prepare(&dir->ring, IORING_OP_READ, job->fd, job->input, (unsigned) job->input_capacity, 0, job_id);
+            break;
+
+        case JOB_READ: {
+            size_t requested = job->input_capacity - job->input_size;
+            job->input_size += (size_t) res;
+
+            if ((size_t) res == requested && requested > 0) {
+                char* input = (char*) realloc(job->input, job->input_capacity * 2);
+                if (input != NULL) {
+                    job->input = input;
+                    job->input_capacity *= 2;
+                    ring_prepare(&dir->ring, IORING_OP_READ, job->fd, job->input + job->input_size,
+                                 (unsigned) (job->input_capacity - job->input_size), job->input_size, job_id);
+                    break;
+                }
+
+                fprintf(stderr, "%s: недостаточно памяти для чтения файла.\n", name);
+                dir->failed_files++;
+                job->failed = true;
+            }
+
+            job->state = JOB_CLOSE_INPUT;
+            ring_prepare(&dir->ring, IORING_OP_CLOSE, job->fd, NULL, 0, 0, job_id);
+            if (!job->failed && solve_file_data(job->input, job->input_size,
+                                dir->options->output == DIRECTORY_OUTPUT_COMBINED ? name : NULL,
+                                dir->options, dir->options->dedup_stats, &job->output) != SUCCESS) {
+                fprintf(stderr, "%s: не удалось сформировать результаты.\n", name);
+                dir->failed_files++;
+                job->failed = true;
+            }
+            break;
+        }
+
+        case JOB_CLOSE_INPUT:
+            if (job->failed) {
+                start_next_file(dir, job, job_id);
+            } else {
+                start_output(dir, job, job_id);
+            }
+            break;
+
+        case JOB_OPEN_OUTPUT:
+            job->fd = res;
+            job->write_offset = 0;
+            if (job->output.size > 0) {
+                write_job_output(dir, job, job_id);
+            } else {
+                job->state = JOB_CLOSE_OUTPUT;
+                ring_prepare(&dir->ring, IORING_OP_CLOSE, job->fd, NULL, 0, 0, job_id);
+            }
+            break;
+
+        case JOB_WRITE:
+            job->written += (size_t) res;
+            if (job->written < job->output.size && res > 0) {
+                write_job_output(dir, job, job_id);
+                break;
+            }
+
+            if (job->written < job->output.size) {
+                fprintf(stderr, "%s: результаты записаны не полностью.\n", name);
+                dir->failed_files++;
+                job->failed = true;
+            }
+            if (job->fd != dir->combined_fd) {
+                job->state = JOB_CLOSE_OUTPUT;
+                ring_prepare(&dir->ring, IORING_OP_CLOSE, job->fd, NULL, 0, 0, job_id);
+            } else {
+                finish_combined_write(dir, job, !job->failed);
+                start_next_file(dir, job, job_id);
+            }
+            break;
+
+        case JOB_CLOSE_OUTPUT:
+            start_next_file(dir, job, job_id);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Закрывает дескрипторы задания, операция которого отменена или завершилась после остановки.
+ *
+ * @param[in]     dir       Состояние обработки каталога.
+ * @param[in,out] job       Задание.
+ * @param[in]     submitted Была ли операция задания передана ядру.
+ * @param[in]     res       Результат завершенной операции (при submitted).
+ */
+static void abandon_job(const UringDirectory* dir, DirectoryJob* job, bool submitted, int res) {
+    switch (job->state) {
+        case JOB_OPEN_INPUT:
+        case JOB_OPEN_OUTPUT:
+            if (submitted && res >= 0) {
+                close(res);
+            }
+            break;
+
+        case JOB_READ:
+        case JOB_WRITE:
+            if (job->fd != dir->combined_fd) {
+                close(job->fd);
+            }
+            break;
+
+        case JOB_CLOSE_INPUT:
+        case JOB_CLOSE_OUTPUT:
+            if (!submitted) {
+                close(job->fd);
+            }
+            break;
+
+        default:
+            break;
+    }
+    job->state = JOB_FREE;
+}
+
+/**
+ * @brief Останавливает обработку каталога после ошибки io_uring.
+ *
+ * @details
+ * Подготовленные, но не переданные ядру SQE удаляются из очереди отправки, после чего
+ * функция дожидается завершения всех переданных операций: до этого ядро еще может
+ * читать в буферы заданий и писать из них. Все открытые дескрипторы заданий закрываются.
+ *
+ * @param[in,out] dir Состояние обработки каталога.
+ * @return true, если все операции завершены и буферы заданий можно освободить.
+ */
+static bool cancel_jobs(UringDirectory* dir) {
+    IoRing* ring = &dir->ring;
+    unsigned head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+    for (unsigned i = head; i != *ring->sq_tail; i++) {
+        size_t job_id = (size_t) ring->sqes[ring->sq_array[i & *ring->sq_mask]].user_data;
+        abandon_job(dir, &dir->jobs[job_id], false, 0);
+    }
+    __atomic_store_n(ring->sq_tail, head, __ATOMIC_RELEASE);
+    ring->to_submit = 0;
+
+    size_t in_flight = 0;
+    for (size_t i = 0; i < DIRECTORY_QUEUE_DEPTH; i++) {
+        if (dir->jobs[i].state == JOB_WAIT_OUTPUT) {
+            dir->jobs[i].state = JOB_FREE;
+        }
+        in_flight += dir->jobs[i].state != JOB_FREE;
+    }
+
+    for (;;) {
+        io_uring_cqe cqe;
+        while (ring_pop_completion(ring, &cqe)) {
+            abandon_job(dir, &dir->jobs[cqe.user_data], true, cqe.res);
+            in_flight--;
+        }
+        if (in_flight == 0) {
+            return true;
+        }
+        if (syscall(__NR_io_uring_enter, ring->fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0 &&
+            errno != EINTR) {
+            return false;
+        }
+    }
+}
+
+/**
+ * @brief Обрабатывает каталог через io_uring.
+ *
+ * @param[in] files       Список файлов.
+ * @param[in] output_path Путь к общему выходному файлу (при DIRECTORY_OUTPUT_COMBINED).
+ * @param[in] options     Параметры обработки.
+ * @param[out] status     SUCCESS, если все файлы обработаны, иначе ERROR_CODE.
+ * @return true, если обработка выполнена через io_uring, false, если io_uring недоступен.
+ */
+static bool solve_directory_uring(const DirectoryFiles* files, const char* output_path,
+                                  const DirectoryOptions* options, int* status) {
+    UringDirectory dir;
+    memset(&dir, 0, sizeof(dir));
+    dir.files = files;
+    dir.options = options;
+    dir.combined_fd = -1;
+
+    if (ring_init(&dir.ring, DIRECTORY_QUEUE_DEPTH) != SUCCESS) {
+        return false;
+    }
+
+    if (options->output == DIRECTORY_OUTPUT_COMBINED) {
+        dir.combined_fd = open(output_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        const char* header = combined_header(options);
+        size_t header_length = strlen(header);
+        if (dir.combined_fd < 0 || write(dir.combined_fd, header, header_length) != (ssize_t) header_length) {
+            fprintf(stderr, "%s: не удалось открыть выходной файл.\n", output_path);
+            if (dir.combined_fd >= 0) {
+                close(dir.combined_fd);
+            }
+            ring_free(&dir.ring);
+            *status = ERROR_CODE;
+            return true;
+        }
+        dir.combined_offset = header_length;
+    }
+
+    DirectoryJob* jobs = (DirectoryJob*) calloc(DIRECTORY_QUEUE_DEPTH, sizeof(DirectoryJob));
+    if (jobs == NULL) {
+        fprintf(stderr, "Недостаточно памяти для заданий io_uring.\n");
+        if (dir.combined_fd >= 0) {
+            close(dir.combined_fd);
+        }
+        ring_free(&dir.ring);
+        *status = ERROR_CODE;
+        return true;
+    }
+    dir.jobs = jobs;
+    for (size_t i = 0; i < DIRECTORY_QUEUE_DEPTH; i++) {
+        dir.active_jobs++;
+        start_next_file(&dir, &jobs[i], i);
+    }
+
+    *status = SUCCESS;
+    while (dir.active_jobs > 0) {
+        if (ring_submit_and_wait(&dir.ring) != SUCCESS) {
+            fprintf(stderr, "Ошибка io_uring: %s\n", strerror(errno));
+            *status = ERROR_CODE;
+            if (!cancel_jobs(&dir)) {
+                jobs = NULL;
+            }
+            break;
+        }
+
+        io_uring_cqe cqe;
+        while (ring_pop_completion(&dir.ring, &cqe)) {
+            size_t job_id = (size_t) cqe.user_data;
+            handle_completion(&dir, &jobs[job_id], job_id, cqe.res);
+        }
+    }
+
+    for (size_t i = 0; jobs != NULL && i < DIRECTORY_QUEUE_DEPTH; i++) {
+        free(jobs[i].input);
+        free_output(&jobs[i].output);
+    }
+    free(jobs);
+    if (dir.combined_fd >= 0 && (ftruncate(dir.combined_fd, (off_t) dir.combined_offset) != 0 ||
+                                 close(dir.combined_fd) != 0)) {
+        *status = ERROR_CODE;
+    }
+    ring_free(&dir.ring);
+
+    if (dir.failed_files > 0) {
+        *status = ERROR_CODE;
+    }
+    return true;
+}
+
+#endif // DIR_SOLVER_HAVE_IO_URING
+
+/**
+ * @brief Читает файл целиком.
+ *
+ * @details
+ * В POSIX-системах размер файла определяется через fstat, а содержимое читается через pread,
+ * в остальных системах - через fread.
+ *
+ * @param[in]     path  Путь к файлу.
+ * @param[in,out] input Буфер для содержимого, переиспользуемый между вызовами.
+ * @return SUCCESS при успехе, иначе ERROR_CODE.
+ */
+static int read_whole_file(const char* path, OutputBuffer* input) {
+    input->size = 0;
+
+#ifdef _WIN32
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        return ERROR_CODE;
+    }
+    char chunk[DIRECTORY_READ_SIZE];
+    size_t bytes = 0;
+    int status = SUCCESS;
+    while ((bytes = fread(chunk, 1, sizeof(chunk), file)) > 0 && status == SUCCESS) {
+        status = append_output(input, chunk, bytes);
+    }
+    if (ferror(file)) {
+        status = ERROR_CODE;
+    }
+    fclose(file);
+    return status;
+#else
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return ERROR_CODE;
+    }
+
+    struct stat file_stat;
+    size_t expected = fstat(fd, &file_stat) == 0 ? (size_t) file_stat.st_size : 0;
+    int status = SUCCESS;
+
+    for (;;) {
+        size_t capacity = (expected > input->size ? expected : input->size) + DIRECTORY_READ_SIZE;
+        if (input->capacity < capacity) {
+            char* data = (char*) realloc(input->data, capacity);
+            if (data == NULL) {
+                status = ERROR_CODE;
+                break;
+            }
+            input->data = data;
+            input->capacity = capacity;
+        }
+
+        ssize_t bytes = pread(fd, input->data + input->size, input->capacity - input->size, (off_t) input->size);
+        if (bytes < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytes <= 0) {
+            status = bytes < 0 ? ERROR_CODE : SUCCESS;
+            break;
+        }
+        input->size += (size_t) bytes;
+    }
+
+    close(fd);
+    return status;
+#endif
+}
+
+/**
+ * @struct ThreadDirectory
+ * @brief Структура для хранения общего состояния обработки каталога пулом потоков.
+ */
+struct ThreadDirectory {
+    const DirectoryFiles* files;       /**< Список файлов. */
+    const DirectoryOptions* options;   /**< Параметры обработки. */
+    FILE* combined;                    /**< Общий выходной файл или NULL. */
+    pthread_mutex_t combined_mutex;    /**< Защищает общий выходной файл и общую статистику. */
+    std::atomic<size_t> next_file;     /**< Номер следующего необработанного файла. */
+    std::atomic<size_t> failed_files;  /**< Количество файлов, обработанных с ошибкой. */
+};
+
+/**
+ * @brief Обрабатывает файлы каталога, пока они не закончатся.
+ *
+ * @param[in,out] argument Общее состояние обработки каталога.
+ * @return NULL.
+ */
+static void* directory_worker(void* argument) {
+    ThreadDirectory* dir = (ThreadDirectory*) argument;
+    const DirectoryFiles* files = dir->files;
+    const DirectoryOptions* options = dir->options;
+
+    OutputBuffer input = {};
+    OutputBuffer output = {};
+    DedupStats stats = {};
+    DedupStats* thread_stats = options->dedup_stats != NULL ? &stats : NULL;
+
+    for (size_t i = dir->next_file++; i < files->count; i = dir->next_file++) {
+        const char* name = files->names[i];
+        if (read_whole_file(files->input_paths[i], &input) != SUCCESS) {
+            fprintf(stderr, "%s: не удалось прочитать входной файл.\n", name);
+            dir->failed_files++;
+            continue;
+        }
+
+        output.size = 0;
+        if (solve_file_data(input.data, input.size, dir->combined != NULL ? name : NULL,
+                            options, thread_stats, &output) != SUCCESS) {
+            fprintf(stderr, "%s: не удалось сформировать результаты.\n", name);
+            dir->failed_files++;
+            continue;
+        }
+
+        if (dir->combined != NULL) {
+            pthread_mutex_lock(&dir->combined_mutex);
+            bool combined_written = fwrite(output.data, 1, output.size, dir->combined) == output.size;
+            pthread_mutex_unlock(&dir->combined_mutex);
+            if (!combined_written) {
+                fprintf(stderr, "%s: не удалось записать результаты в общий файл.\n", name);
+                dir->failed_files++;
+            }
+            continue;
+        }
+
+        FILE* file = fopen(files->output_paths[i], "wb");
+        bool written = file != NULL && fwrite(output.data, 1, output.size, file) == output.size;
+        if (file == NULL || fclose(file) != 0 || !written) {
+            fprintf(stderr, "%s: не удалось записать выходной файл.\n", name);
+            dir->failed_files++;
+        }
+    }
+
+    free_output(&input);
+    free_output(&output);
+
+    if (thread_stats != NULL) {
+        pthread_mutex_lock(&dir->combined_mutex);
+        merge_dedup_stats(options->dedup_stats, thread_stats);
+        pthread_mutex_unlock(&dir->combined_mutex);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Обрабатывает каталог пулом потоков с чтением файлов через pread.
+ *
+ * @param[in] files       Список файлов.
+ * @param[in] output_path Путь к общему выходному файлу (при DIRECTORY_OUTPUT_COMBINED).
+ * @param[in] options     Параметры обработки.
+ * @return SUCCESS, если все файлы обработаны, иначе ERROR_CODE.
+ */
+static int solve_directory_threads(const DirectoryFiles* files, const char* output_path,
+                                   const DirectoryOptions* options) {
+    ThreadDirectory dir;
+    dir.files = files;
+    dir.options = options;
+    dir.combined = NULL;
+    dir.next_file = 0;
+    dir.failed_files = 0;
+
+    if (options->output == DIRECTORY_OUTPUT_COMBINED) {
+        dir.combined = fopen(output_path, "wb");
+        if (dir.combined == NULL || fputs(combined_header(options), dir.combined) == EOF) {
+            fprintf(stderr, "%s: не удалось открыть выходной файл.\n", output_path);
+            if (dir.combined != NULL) {
+                fclose(dir.combined);
+            }
+            return ERROR_CODE;
+        }
+    }
+    pthread_mutex_init(&dir.combined_mutex, NULL);
+
+    unsigned num_threads = count_processors();
+    pthread_t* threads = (pthread_t*) calloc(num_threads, sizeof(pthread_t));
+    unsigned num_started = 0;
+    while (threads != NULL && num_started + 1 < num_threads &&
+           pthread_create(&threads[num_started], NULL, directory_worker, &dir) == 0) {
+        num_started++;
+    }
+    directory_worker(&dir);
+    for (unsigned i = 0; i < num_started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    pthread_mutex_destroy(&dir.combined_mutex);
+
+    if (dir.combined != NULL && fclose(dir.combined) != 0) {
+        return ERROR_CODE;
+    }
+    return dir.failed_files == 0 ? SUCCESS : ERROR_CODE;
+}
+
+/**
+ * @brief Решает уравнения всех файлов каталога.
+ *
+ * @details
+ * Функция составляет список файлов и обрабатывает его через io_uring, если он разрешен
+ * параметрами и поддерживается ядром, иначе - пулом потоков с pread.
+ *
+ * @param[in] input_dir   Путь к входному каталогу.
+ * @param[in] output_path Путь к общему выходному файлу или к выходному каталогу.
+ * @param[in] options     Параметры обработки.
+ * @return SUCCESS, если все файлы обработаны, иначе ERROR_CODE.
+ */
+int solve_directory(const char* input_dir, const char* output_path, const DirectoryOptions* options) {
+    assert(input_dir != NULL);
+    assert(output_path != NULL);
+    assert(options != NULL);
+
+    DirectoryFiles files = {};
+    if (list_directory(input_dir, output_path, options, &files) != SUCCESS) {
+        free_directory_files(&files);
+        return ERROR_CODE;
+    }
+
+    int status = SUCCESS;
+#ifdef DIR_SOLVER_HAVE_IO_URING
+    if (!options->use_io_uring || !solve_directory_uring(&files, output_path, options, &status)) {
+        status = solve_directory_threads(&files, output_path, options);
+    }
+#else
+    status = solve_directory_threads(&files, output_path, options);
+#endif
+
+    free_directory_files(&files);
+    return status;
+}
@@ -0,0 +1,523 @@
+/**
+ * @file follow_solver.cpp
+ * @brief Режим слежения за дописываемыми входными файлами.
+ *
+ * @details
+ * Этот файл содержит реализацию режима слежения. Новые данные каждого входного файла
+ * читаются блоками по FOLLOW_CHUNK_SIZE байт, полные строки разбираются и решаются пакетами
+ * по FOLLOW_BATCH_SIZE уравнений. После записи результатов выходной файл сбрасывается на диск,
+ * и только затем сохраняется контрольная точка, поэтому после сбоя строка может быть
+ * обработана повторно, но не может быть потеряна.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <errno.h>
+#include <assert.h>
+#include <stdbool.h>
+#include "follow_solver.h"
+#include "record_io.h"
+#include "solver.h"
+#include "error_code.h"
+
+#ifdef __linux__
+#include <poll.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+#elif defined(_WIN32)
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Размер блока, читаемого из входного файла за один раз.
+ */
+const size_t FOLLOW_CHUNK_SIZE = 64 * 1024;
+
+/**
+ * @brief Максимальное количество уравнений, решаемых одним пакетом.
+ */
+const size_t FOLLOW_BATCH_SIZE = 1024;
+
+#ifdef __linux__
+/**
+ * @brief Максимальное время ожидания события inotify перед повторной проверкой запроса остановки, в мс.
+ */
+const int FOLLOW_STOP_CHECK_MS = 100;
+#else
+/**
+ * @brief Интервал опроса входных файлов в системах без inotify, в мс.
+ */
+const int FOLLOW_POLL_INTERVAL_MS = 5;
+#endif
+
+/**
+ * @struct FollowedFile
+ * @brief Структура для хранения состояния отслеживаемого файла.
+ */
+struct FollowedFile {
+    const char* path;         /**< Путь к входному файлу. */
+    FILE* file;               /**< Открытый входной файл. */
+    long long offset;         /**< Смещение первой необработанной строки. */
+    char* buffer;             /**< Буфер чтения размером FOLLOW_CHUNK_SIZE. */
+    size_t pending;           /**< Длина незавершенной строки в начале буфера. */
+    bool skipping_line;       /**< Пропускается ли слишком длинная строка до ближайшего перевода строки. */
+};
+
+/**
+ * @brief Флаг запроса остановки режима слежения.
+ */
+static volatile sig_atomic_t stop_requested = 0;
+
+/**
+ * @brief Обработчик сигнала SIGINT для режима слежения.
+ *
+ * @param[in] signal_number Номер полученного сигнала.
+ */
+static void handle_stop_signal(int signal_number) {
+    (void) signal_number;
+    stop_requested = 1;
+}
+
+/**
+ * @brief Запрашивает остановку @ref follow_files.
+ *
+ * @details
+ * Функция только устанавливает флаг, поэтому ее можно вызывать из обработчика сигнала.
+ */
+void stop_following() {
+    stop_requested = 1;
+}
+
+/**
+ * @brief Устанавливает позицию в файле с поддержкой смещений больше 2 ГБ.
+ *
+ * @param[in] file   Файл.
+ * @param[in] offset Смещение от начала файла.
+ * @return SUCCESS при успехе, иначе ERROR_CODE.
+ */
+static int seek_file(FILE* file, long long offset) {
+#ifdef _WIN32
+    return _fseeki64(file, offset, SEEK_SET) == 0 ? SUCCESS : ERROR_CODE;
+#else
+    return fseeko(file, (off_t) offset, SEEK_SET) == 0 ? SUCCESS : ERROR_CODE;
+#endif
+}
+
+/**
+ * @brief Формирует имя файла контрольной точки для входного файла.
+ *
+ * @param[out] checkpoint_path Буфер размером FILENAME_MAX.
+ * @param[in]  input_path      Путь к входному файлу.
+ * @return SUCCESS, если имя поместилось в буфер, иначе ERROR_CODE.
+ */
+static int make_checkpoint_path(char* checkpoint_path, const char* input_path) {
+    int length = snprintf(checkpoint_path, FILENAME_MAX, "%s%s", input_path, FOLLOW_CHECKPOINT_SUFFIX);
+    return (length > 0 && length < FILENAME_MAX) ? SUCCESS : ERROR_CODE;
+}
+
+/**
+ * @brief Загружает контрольную точку входного файла.
+ *
+ * @param[in] input_path Путь к входному файлу.
+ * @return Сохраненное смещение или 0, если контрольной точки нет.
+ */
+static long long load_checkpoint(const char* input_path) {
+    char checkpoint_path[FILENAME_MAX] = "";
+    if (make_checkpoint_path(checkpoint_path, input_path) != SUCCESS) {
+        return 0;
+    }
+
+    FILE* checkpoint = fopen(checkpoint_path, "r");
+    if (checkpoint == NULL) {
+        return 0;
+    }
+
+    long long offset = 0;
+    if (fscanf(checkpoint, "%lld", &offset) != 1 || offset < 0) {
+        offset = 0;
+    }
+    fclose(checkpoint);
+    return offset;
+}
+
+/**
+ * @brief Сохраняет контрольную точку входного файла.
+ *
+ * @details
+ * Смещение записывается во временный файл, который затем переименовывается,
+ * чтобы при сбое не остался частично записанный файл контрольной точки.
+ *
+ * @param[in] input_path Путь к входному файлу.
+ * @param[in] offset     Смещение первой необработанной строки.
+ * @return SUCCESS при успехе, иначе ERROR_CODE.
+ */
+static int save_checkpoint(const char* input_path, long long offset) {
+    char checkpoint_path[FILENAME_MAX] = "";
+    char temp_path[FILENAME_MAX] = "";
+    if (make_checkpoint_path(checkpoint_path, input_path) != SUCCESS) {
+        return ERROR_CODE;
+    }
+    int length = snprintf(temp_path, FILENAME_MAX, "%s.tmp", checkpoint_path);
+    if (length <= 0 || length >= FILENAME_MAX) {
+        return ERROR_CODE;
+    }
+
+    FILE* checkpoint = fopen(temp_path, "w");
+    if (checkpoint == NULL) {
+        return ERROR_CODE;
+    }
+    bool written = fprintf(checkpoint, "%lld\n", offset) > 0;
+    written = (fclose(checkpoint) == 0) && written;
+    if (!written) {
+        return ERROR_CODE;
+    }
+
+#ifdef _WIN32
+    remove(checkpoint_path);
+#endif
+    return rename(temp_path, checkpoint_path) == 0 ? SUCCESS : ERROR_CODE;
+}
+
+/**
+ * @brief Сбрасывает выходной файл на диск.
+ *
+ * @details
+ * Сначала сбрасывается буфер stdio, затем данные файла принудительно записываются
+ * на устройство, чтобы контрольная точка не опередила результаты при сбое питания.
+ * Файлы, которые не поддерживают синхронизацию (каналы, терминалы), считаются сброшенными.
+ * Флаг ошибки потока проверяется отдельно: ошибка при автоматическом сбросе буфера во время
+ * предыдущих записей не повторяется в fflush.
+ *
+ * @param[in] output Выходной файл.
+ * @return SUCCESS при успехе, иначе ERROR_CODE.
+ */
+static int sync_output(FILE* output) {
+    if (fflush(output) != 0 || ferror(output)) {
+        return ERROR_CODE;
+    }
+#ifdef _WIN32
+    return _commit(_fileno(output)) == 0 ? SUCCESS : ERROR_CODE;
+#else
+    return (fsync(fileno(output)) == 0 || errno == EINVAL) ? SUCCESS : ERROR_CODE;
+#endif
+}
+
+/**
+ * @brief Решает пакет уравнений и дописывает результаты в выходной файл.
+ *
+ * @param[in]  output  Выходной файл.
+ * @param[in]  tag     Имя входного файла для префикса записей или NULL.
+ * @param[in]  coeffts Массив коэффициентов пакета.
+ * @param[out] results Массив для результатов пакета.
+ * @param[in]  count   Количество уравнений в пакете.
+ * @return SUCCESS при успехе, ERROR_CODE при ошибке записи.
+ */
+static int write_batch(FILE* output, const char* tag, const SquareEquationCoefficient* coeffts,
+                       SquareEquationResult* results, size_t count) {
+    solve_square_equations(coeffts, results, count);
+
+    char record[MAX_RECORD_LENGTH] = "";
+    for (size_t i = 0; i < count; i++) {
+        size_t length = format_solution_record(record, RECORD_TEXT, coeffts[i], results[i]);
+        if (tag != NULL && fprintf(output, "%s: ", tag) < 0) {
+            return ERROR_CODE;
+        }
+        if (fwrite(record, 1, length, output) != length) {
+            return ERROR_CODE;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * @brief Обрабатывает все новые полные строки входного файла.
+ *
+ * @details
+ * Функция читает файл до текущего конца, решает найденные уравнения пакетами и после
+ * каждого прочитанного блока сбрасывает выходной файл и сохраняет контрольную точку.
+ * Незавершенная последняя строка остается в буфере до следующего вызова.
+ *
+ * @param[in,out] followed Состояние входного файла.
+ * @param[in]     output   Выходной файл.
+ * @param[in]     tag      Имя входного файла для префикса записей или NULL.
+ * @param[in]     coeffts  Рабочий массив коэффициентов размером FOLLOW_BATCH_SIZE.
+ * @param[in]     results  Рабочий массив результатов размером FOLLOW_BATCH_SIZE.
+ * @return SUCCESS при успехе, иначе ERROR_CODE.
+ */
+static int process_new_data(FollowedFile* followed, FILE* output, const char* tag,
+                            SquareEquationCoefficient* coeffts, SquareEquationResult* results) {
+    assert(followed != NULL);
+    assert(output != NULL);
+
+    for (;;) {
+        size_t bytes = fread(followed->buffer + followed->pending, 1,
+                             FOLLOW_CHUNK_SIZE - followed->pending, followed->file);
+        if (bytes == 0) {
+            clearerr(followed->file);
+            return SUCCESS;
+        }
+
+        size_t end = followed->pending + bytes;
+        size_t line_start = 0;
+        size_t batch_size = 0;
+
+        for (size_t i = followed->pending; i < end; i++) {
+            if (followed->buffer[i] != '\n') {
+                continue;
+            }
+
+            size_t line_end = i;
+            if (line_end > line_start && followed->buffer[line_end - 1] == '\r') {
+                line_end--;
+            }
+
+            if (followed->skipping_line) {
+                followed->skipping_line = false;
+            } else if (line_end > line_start) {
+                if (parse_coefficients_line(followed->buffer + line_start, line_end - line_start,
+                                            &coeffts[batch_size]) == SUCCESS) {
+                    if (++batch_size == FOLLOW_BATCH_SIZE) {
+                        if (write_batch(output, tag, coeffts, results, batch_size) != SUCCESS) {
+                            fprintf(stderr, "Ошибка записи в выходной файл.\n");
+                            return ERROR_CODE;
+                        }
+                        batch_size = 0;
+                    }
+                } else {
+                    fprintf(stderr, "%s: пропущена некорректная строка по смещению %lld\n",
+                            followed->path, followed->offset + (long long) line_start);
+                }
+            }
+            line_start = i + 1;
+        }
+
+        if (write_batch(output, tag, coeffts, results, batch_size) != SUCCESS) {
+            fprintf(stderr, "Ошибка записи в выходной файл.\n");
+            return ERROR_CODE;
+        }
+
+        if (line_start == 0 && end == FOLLOW_CHUNK_SIZE) {
+            fprintf(stderr, "%s: пропущена слишком длинная строка по смещению %lld\n",
+                    followed->path, followed->offset);
+            followed->skipping_line = true;
+            line_start = end;
+        }
+
+        if (sync_output(output) != SUCCESS) {
+            fprintf(stderr, "Ошибка записи в выходной файл.\n");
+            return ERROR_CODE;
+        }
+
+        followed->offset += (long long) line_start;
+        followed->pending = end - line_start;
+        memmove(followed->buffer, followed->buffer + line_start, followed->pending);
+
+        if (save_checkpoint(followed->path, followed->offset) != SUCCESS) {
+            fprintf(stderr, "%s: не удалось сохранить контрольную точку.\n", followed->path);
+            return ERROR_CODE;
+        }
+    }
+}
+
+/**
+ * @brief Открывает входной файл и переходит к сохраненной контрольной точке.
+ *
+ * @param[out] followed Состояние входного файла.
+ * @param[in]  path     Путь к входному файлу.
+ * @return SUCCESS при успехе, иначе ERROR_CODE.
+ */
+static int open_followed_file(FollowedFile* followed, const char* path) {
+    followed->path = path;
+    followed->pending = 0;
+    followed->skipping_line = false;
+    followed->offset = load_checkpoint(path);
+    followed->buffer = (char*) malloc(FOLLOW_CHUNK_SIZE);
+    followed->file = fopen(path, "rb");
+
+    if (followed->buffer == NULL || followed->file == NULL) {
+        fprintf(stderr, "%s: не удалось открыть входной файл.\n", path);
+        return ERROR_CODE;
+    }
+
+    if (seek_file(followed->file, followed->offset) != SUCCESS) {
+        fprintf(stderr, "%s: не удалось перейти к контрольной точке %lld.\n", path, followed->offset);
+        return ERROR_CODE;
+    }
+    return SUCCESS;
+}
+
+/**
+ * @brief Закрывает входной файл и освобождает его буфер.
+ *
+ * @param[in,out] followed Состояние входного файла.
+ */
+static void close_followed_file(FollowedFile* followed) {
+    if (followed->file != NULL) {
+        fclose(followed->file);
+        followed->file = NULL;
+    }
+    free(followed->buffer);
+    followed->buffer = NULL;
+}
+
+/**
+ * @brief Следит за входными файлами и решает дописываемые в них уравнения.
+ *
+ * @details
+ * Функция открывает все входные файлы, переходит к их контрольным точкам и обрабатывает
+ * уже накопленные строки. Затем она ожидает изменений: в Linux - через inotify, в остальных
+ * системах - опросом каждые FOLLOW_POLL_INTERVAL_MS мс, - и обрабатывает новые данные.
+ *
+ * @param[in] input_paths Массив путей к входным файлам.
+ * @param[in] num_inputs  Количество входных файлов, не более MAX_FOLLOWED_FILES.
+ * @param[in] output_path Путь к выходному файлу, в который дописываются результаты.
+ * @return SUCCESS при штатной остановке, иначе ERROR_CODE.
+ */
+int follow_files(const char* const* input_paths, size_t num_inputs, const char* output_path) {
+    assert(input_paths != NULL);
+    assert(output_path != NULL);
+
+    if (num_inputs == 0 || num_inputs > MAX_FOLLOWED_FILES) {
+        fprintf(stderr, "Количество входных файлов должно быть от 1 до %zu.\n", MAX_FOLLOWED_FILES);
+        return ERROR_CODE;
+    }
+
+    FILE* output = fopen(output_path, "a");
+    if (output == NULL) {
+        fprintf(stderr, "%s: не удалось открыть выходной файл.\n", output_path);
+        return ERROR_CODE;
+    }
+
+    static SquareEquationCoefficient coeffts[FOLLOW_BATCH_SIZE];
+    static SquareEquationResult results[FOLLOW_BATCH_SIZE];
+    FollowedFile followed[MAX_FOLLOWED_FILES] = {};
+    int status = SUCCESS;
+
+    for (size_t i = 0; i < num_inputs && status == SUCCESS; i++) {
+        status = open_followed_file(&followed[i], input_paths[i]);
+    }
+
+#ifdef __linux__
+    int notify_fd = inotify_init1(IN_CLOEXEC);
+    if (notify_fd < 0) {
+        fprintf(stderr, "Не удалось инициализировать inotify.\n");
+        status = ERROR_CODE;
+    }
+    for (size_t i = 0; i < num_inputs && status == SUCCESS; i++) {
+        if (inotify_add_watch(notify_fd, input_paths[i], IN_MODIFY) < 0) {
+            fprintf(stderr, "%s: не удалось установить наблюдение.\n", input_paths[i]);
+            status = ERROR_CODE;
+        }
+    }
+#endif
+
+    stop_requested = 0;
+    void (*previous_handler)(int) = signal(SIGINT, handle_stop_signal);
+    bool tag_records = num_inputs > 1;
+
+    while (status == SUCCESS && !stop_requested) {
+        for (size_t i = 0; i < num_inputs && status == SUCCESS; i++) {
+            status = process_new_data(&followed[i], output, tag_records ? followed[i].path : NULL,
+                                      coeffts, results);
+        }
+
+        if (status != SUCCESS || stop_requested) {
+            break;
+        }
+
+#ifdef __linux__
+        struct pollfd notify_poll = { notify_fd, POLLIN, 0 };
+        int ready = poll(&notify_poll, 1, FOLLOW_STOP_CHECK_MS);
+        if (ready > 0) {
+            char events[4096];
+            if (read(notify_fd, events, sizeof(events)) < 0 && errno != EINTR && errno != EAGAIN) {
+                status = ERROR_CODE;
+            }
+        } else if (ready < 0 && errno != EINTR) {
+            status = ERROR_CODE;
+        }
+#elif defined(_WIN32)
+        Sleep(FOLLOW_POLL_INTERVAL_MS);
+#else
+        usleep(FOLLOW_POLL_INTERVAL_MS * 1000);
+#endif
+    }
+
+    signal(SIGINT, previous_handler);
+
+#ifdef __linux__
+    if (notify_fd >= 0) {
+        close(notify_fd);
+    }
+#endif
+
+    for (size_t i = 0; i < num_inputs; i++) {
+        close_followed_file(&followed[i]);
+    }
+    fclose(output);
+    return status;
+}
+
+/**
+ * @brief Читает из stdin непустую строку без символа перевода строки.
+ *
+ * @param[out] line Буфер для строки.
+ * @param[in]  size Размер буфера.
+ * @return true, если строка прочитана, иначе false.
+ */
+static bool read_nonempty_line(char* line, size_t size) {
+    while (fgets(line, (int) size, stdin) != NULL) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[strspn(line, " \t")] != '\0') {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Запускает режим слежения, запрашивая пути к файлам у пользователя.
+ *
+ * @details
+ * Функция запрашивает путь к файлу результатов и пути к входным файлам, разделенные
+ * пробелами, после чего вызывает @ref follow_files.
+ *
+ * @return SUCCESS при штатной остановке, иначе ERROR_CODE.
+ */
+int run_follow_mode() {
+    char output_path[FILENAME_MAX] = "";
+    static char input_line[MAX_FOLLOWED_FILES * FILENAME_MAX];
+    const char* input_paths[MAX_FOLLOWED_FILES] = {};
+
+    printf("Введите путь к файлу результатов: ");
+    if (!read_nonempty_line(output_path, sizeof(output_path))) {
+        printf("Ошибка ввода! Обнаружен EOF.\n");
+        return ERROR_CODE;
+    }
+
+    printf("Введите пути к входным файлам через пробел: ");
+    if (!read_nonempty_line(input_line, sizeof(input_line))) {
+        printf("Ошибка ввода! Обнаружен EOF.\n");
+        return ERROR_CODE;
+    }
+
+    size_t num_inputs = 0;
+    for (char* path = strtok(input_line, " \t"); path != NULL; path = strtok(NULL, " \t")) {
+        if (num_inputs == MAX_FOLLOWED_FILES) {
+            fprintf(stderr, "Слишком много входных файлов, максимум %zu.\n", MAX_FOLLOWED_FILES);
+            return ERROR_CODE;
+        }
+        input_paths[num_inputs++] = path;
+    }
+
+    printf("Слежение запущено. Для остановки нажмите Ctrl+C.\n");
+    return follow_files(input_paths, num_inputs, output_path);
+}
@@ -0,0 +1,341 @@
+/**
+ * @file int_solver.cpp
+ * @brief Точное решение квадратных уравнений с целыми коэффициентами.
+ *
+ * @details
+ * Этот файл содержит функции для решения уравнений с целыми коэффициентами без EPSILON.
+ * Дискриминант вычисляется в 128-битных целых числах (__int128 GCC и Clang). Перед
+ * извлечением целого квадратного корня дискриминант проверяется по вычетам по модулю 64,
+ * что отсекает большую часть чисел, не являющихся полными квадратами, без вызова sqrt.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+
+#include <stdlib.h>
+#include <limits.h>
+#include <stdint.h>
+#include <math.h>
+#include <assert.h>
+#include <stdbool.h>
+#include "int_solver.h"
+#include "error_code.h"
+#include "branchless_select.h"
+
+/**
+ * @brief 128-битное знаковое целое для точного вычисления дискриминанта.
+ */
+typedef __int128 WideInt;
+
+/**
+ * @brief Битовая маска квадратичных вычетов по модулю 64.
+ *
+ * @details
+ * Бит r установлен, если существует целое x, такое что x^2 mod 64 = r.
+ */
+const unsigned long long SQUARE_RESIDUES_MOD_64 = 0x0202021202030213ULL;
+
+/**
+ * @brief Размер блока для обработки пакета с небольшими целыми коэффициентами.
+ */
+const size_t SMALL_INT_BLOCK_SIZE = 256;
+
+/**
+ * @brief Преобразует число с плавающей точкой в целое, если оно целое и не превышает limit по модулю.
+ *
+ * @param[in]  value  Число для преобразования.
+ * @param[in]  limit  Максимальный допустимый модуль.
+ * @param[out] result Указатель на результат или NULL.
+ * @return true, если число целое и не превышает limit по модулю, иначе false.
+ */
+static bool to_int(double value, long long limit, long long* result) {
+    if (!(fabs(value) <= (double) limit) || value != trunc(value)) {
+        return false;
+    }
+    if (result != NULL) {
+        *result = (long long) value;
+    }
+    return true;
+}
+
+/**
+ * @brief Вычисляет наибольший общий делитель двух неотрицательных чисел.
+ *
+ * @param[in] x Первое число.
+ * @param[in] y Второе число.
+ * @return Наибольший общий делитель x и y.
+ */
+static long long gcd(long long x, long long y) {
+    while (y != 0) {
+        long long remainder = x % y;
+        x = y;
+        y = remainder;
+    }
+    return x;
+}
+
+/**
+ * @brief Составляет несократимую дробь с положительным знаменателем.
+ *
+ * @param[in] num Числитель.
+ * @param[in] den Знаменатель, не равный нулю.
+ * @return Несократимая дробь num / den.
+ */
+static RationalRoot make_rational(long long num, long long den) {
+    assert(den != 0);
+
+    if (den < 0) {
+        num = -num;
+        den = -den;
+    }
+    long long divisor = gcd(llabs(num), den);
+    RationalRoot root = { num / divisor, den / divisor };
+    return root;
+}
+
+/**
+ * @brief Преобразует дробь в число с плавающей точкой.
+ *
+ * @param[in] root Дробь.
+ * @return Значение дроби.
+ */
+static inline double rational_to_double(RationalRoot root) {
+    return (double) root.num / (double) root.den;
+}
+
+/**
+ * @brief Преобразует неотрицательное 128-битное число в double с правильным округлением.
+ *
+ * @details
+ * Компилятор преобразует __int128 в double вызовом __floattidf из libgcc_s, а эта библиотека
+ * иначе не нужна программе и замедляет ее запуск. Поэтому число сдвигается так, чтобы
+ * поместиться в long long, а выдвинутые биты собираются в младший бит ("липкий" бит):
+ * в сдвинутом числе не меньше 63 значащих бит, поэтому округление при преобразовании
+ * long long в double остается таким же, как у исходного числа.
+ *
+ * @param[in] value Неотрицательное число.
+ * @return Ближайшее к value число double.
+ */
+static double wide_to_double(WideInt value) {
+    assert(value >= 0);
+
+    int shift = 0;
+    while ((value >> shift) > (WideInt) LLONG_MAX) {
+        shift++;
+    }
+
+    long long high = (long long) (value >> shift);
+    if (shift > 0 && (value & (((WideInt) 1 << shift) - 1)) != 0) {
+        high |= 1;
+    }
+    return ldexp((double) high, shift);
+}
+
+/**
+ * @brief Проверяет, является ли положительное число полным квадратом.
+ *
+ * @details
+ * Сначала число проверяется по вычетам по модулю 64. Только если проверка пройдена,
+ * приближение корня вычисляется через sqrt и уточняется в целых числах.
+ *
+ * @param[in]  value Положительное число, не больше 2^110.
+ * @param[out] root  Указатель на целый квадратный корень числа.
+ * @return true, если число является полным квадратом, иначе false.
+ */
+static bool is_perfect_square(WideInt value, long long* root) {
+    assert(value > 0);
+    assert(root != NULL);
+
+    if (((SQUARE_RESIDUES_MOD_64 >> (int) (value & 63)) & 1) == 0) {
+        return false;
+    }
+
+    WideInt candidate = (long long) sqrt(wide_to_double(value));
+    while (candidate * candidate > value) {
+        candidate--;
+    }
+    while ((candidate + 1) * (candidate + 1) <= value) {
+        candidate++;
+    }
+
+    *root = (long long) candidate;
+    return candidate * candidate == value;
+}
+
+/**
+ * @brief Проверяет, являются ли коэффициенты уравнения целыми, и преобразует их.
+ *
+ * @details
+ * Коэффициенты считаются целыми, если они не имеют дробной части и их модуль
+ * не превышает INT_COEFF_LIMIT. NaN и бесконечности целыми не считаются.
+ *
+ * @param[in]  coeffts     Коэффициенты уравнения.
+ * @param[out] int_coeffts Указатель на структуру для целых коэффициентов или NULL.
+ * @return true, если все коэффициенты целые, иначе false.
+ */
+bool is_int_coefficient(SquareEquationCoefficient coeffts, IntSquareEquationCoefficient* int_coeffts) {
+    IntSquareEquationCoefficient converted = {0, 0, 0};
+
+    if (!to_int(coeffts.a, INT_COEFF_LIMIT, &converted.a) ||
+        !to_int(coeffts.b, INT_COEFF_LIMIT, &converted.b) ||
+        !to_int(coeffts.c, INT_COEFF_LIMIT, &converted.c)) {
+        return false;
+    }
+
+    if (int_coeffts != NULL) {
+        *int_coeffts = converted;
+    }
+    return true;
+}
+
+/**
+ * @brief Проверяет, являются ли коэффициенты уравнения целыми по модулю не больше SMALL_INT_COEFF_LIMIT.
+ *
+ * @param[in] coeffts Коэффициенты уравнения.
+ * @return true, если уравнение может быть решено @ref solve_small_int_square_equations, иначе false.
+ */
+bool is_small_int_coefficient(SquareEquationCoefficient coeffts) {
+    return to_int(coeffts.a, SMALL_INT_COEFF_LIMIT, NULL) &&
+           to_int(coeffts.b, SMALL_INT_COEFF_LIMIT, NULL) &&
+           to_int(coeffts.c, SMALL_INT_COEFF_LIMIT, NULL);
+}
+
+/**
+ * @brief Точно решает квадратное уравнение с целыми коэффициентами.
+ *
+ * @details
+ * Если a равно нулю, уравнение решается как линейное. Иначе дискриминант вычисляется
+ * в 128-битных целых числах и сравнивается с нулем точно. sqrt вызывается только
+ * для положительного дискриминанта, который не является полным квадратом.
+ *
+ * @param[in]  coeffts Целые коэффициенты уравнения, по модулю не больше INT_COEFF_LIMIT.
+ * @param[out] result  Указатель на структуру для результата.
+ * @return SUCCESS при успешном решении, ERROR_CODE, если коэффициент выходит за INT_COEFF_LIMIT.
+ */
+int solve_int_square_equation(IntSquareEquationCoefficient coeffts, ExactSquareEquationResult* result) {
+    assert(result != NULL);
+
+    if (llabs(coeffts.a) > INT_COEFF_LIMIT ||
+        llabs(coeffts.b) > INT_COEFF_LIMIT ||
+        llabs(coeffts.c) > INT_COEFF_LIMIT) {
+        return ERROR_CODE;
+    }
+
+    ExactSquareEquationResult exact = {};
+    exact.result.result_type = NoRoots;
+
+    if (coeffts.a == 0) {
+        if (coeffts.b == 0) {
+            exact.result.result_type = coeffts.c == 0 ? InfRoots : NoRoots;
+        } else {
+            exact.x1_exact = make_rational(-coeffts.c, coeffts.b);
+            exact.result.x1 = rational_to_double(exact.x1_exact);
+            exact.result.result_type = OneRoot;
+            exact.is_rational = true;
+        }
+        *result = exact;
+        return SUCCESS;
+    }
+
+    WideInt dscr = (WideInt) coeffts.b * coeffts.b - 4 * (WideInt) coeffts.a * coeffts.c;
+    long long dscr_root = 0;
+
+    if (dscr == 0) {
+        exact.x1_exact = make_rational(-coeffts.b, 2 * coeffts.a);
+        exact.result.x1 = rational_to_double(exact.x1_exact);
+        exact.result.result_type = OneRoot;
+        exact.is_rational = true;
+    } else if (dscr > 0 && is_perfect_square(dscr, &dscr_root)) {
+        exact.x1_exact = make_rational(-coeffts.b + dscr_root, 2 * coeffts.a);
+        exact.x2_exact = make_rational(-coeffts.b - dscr_root, 2 * coeffts.a);
+        exact.result.x1 = rational_to_double(exact.x1_exact);
+        exact.result.x2 = rational_to_double(exact.x2_exact);
+        exact.result.result_type = TwoRoots;
+        exact.is_rational = true;
+    } else if (dscr > 0) {
+        double dscr_sqrt = sqrt(wide_to_double(dscr));
+        exact.result.x1 = (-(double) coeffts.b + dscr_sqrt) / (2 * (double) coeffts.a);
+        exact.result.x2 = (-(double) coeffts.b - dscr_sqrt) / (2 * (double) coeffts.a);
+        exact.result.result_type = TwoRoots;
+    }
+
+    *result = exact;
+    return SUCCESS;
+}
+
+/**
+ * @brief Решает пакет уравнений с небольшими целыми коэффициентами.
+ *
+ * @details
+ * Пакет обрабатывается блоками по SMALL_INT_BLOCK_SIZE уравнений в три цикла:
+ * 1. Вычисляются дискриминанты.
+ * 2. Для каждого уравнения вычисляются корни, тип результата определяется битовыми масками,
+ *    а нужный числитель, знаменатель и обнуление отсутствующих корней выбираются
+ *    @ref select_double, как в @ref solve_square_equation_branchless. Деление выполняется
+ *    всегда: знаменатель линейного уравнения с b = 0 заменяется единицей. К корням
+ *    прибавляется +0.0, чтобы нулевой корень (-c / b при c = 0 или 0 / (2a) при a < 0)
+ *    был +0.0, как в @ref solve_int_square_equation, а не -0.0.
+ * 3. Результаты собираются в массив структур.
+ *
+ * Циклы не содержат переходов, зависящих от данных. Первый цикл векторизуется GCC при -O3
+ * (или -O2 -ftree-vectorize). Второй дополнительно требует -fno-math-errno (иначе sqrt
+ * может изменять errno) и 64-битных векторных сравнений, то есть на x86 не ниже SSE4.2
+ * (-march=x86-64-v2 или -mavx2). При обычной сборке с -O2 циклы остаются скалярными.
+ * Флаги нельзя задать только для этой функции: GCC не учитывает math-errno в атрибуте
+ * optimize и в #pragma GCC optimize, поэтому они задаются при сборке (см. README).
+ * Корень из дискриминанта - полного квадрата вычисляется sqrt без погрешности.
+ *
+ * @param[in]  a       Массив коэффициентов a.
+ * @param[in]  b       Массив коэффициентов b.
+ * @param[in]  c       Массив коэффициентов c.
+ * @param[out] results Массив для результатов, размером не менее count.
+ * @param[in]  count   Количество уравнений в пакете.
+ */
+void solve_small_int_square_equations(const double* a, const double* b, const double* c,
+                                      SquareEquationResult* results, size_t count) {
+    assert(count == 0 || (a != NULL && b != NULL && c != NULL && results != NULL));
+
+    double dscr[SMALL_INT_BLOCK_SIZE];
+    double x1[SMALL_INT_BLOCK_SIZE];
+    double x2[SMALL_INT_BLOCK_SIZE];
+    uint64_t result_type[SMALL_INT_BLOCK_SIZE];
+
+    for (size_t start = 0; start < count; start += SMALL_INT_BLOCK_SIZE) {
+        size_t block_size = count - start < SMALL_INT_BLOCK_SIZE ? count - start : SMALL_INT_BLOCK_SIZE;
+        const double* block_a = a + start;
+        const double* block_b = b + start;
+        const double* block_c = c + start;
+
+        for (size_t i = 0; i < block_size; i++) {
+            dscr[i] = block_b[i] * block_b[i] - 4 * block_a[i] * block_c[i];
+        }
+
+        for (size_t i = 0; i < block_size; i++) {
+            uint64_t a_zero = make_mask(block_a[i] == 0);
+            uint64_t b_zero = make_mask(block_b[i] == 0);
+            uint64_t c_zero = make_mask(block_c[i] == 0);
+            uint64_t dscr_positive = make_mask(dscr[i] > 0);
+            uint64_t dscr_zero = make_mask(dscr[i] == 0);
+
+            double dscr_sqrt = sqrt(select_double(dscr_positive, dscr[i], 0));
+            double numerator = select_double(a_zero, -block_c[i], -block_b[i] + dscr_sqrt);
+            double denominator = select_double(a_zero, select_double(b_zero, 1, block_b[i]), 2 * block_a[i]);
+            double root_x1 = numerator / denominator;
+            double root_x2 = (-block_b[i] - dscr_sqrt) / denominator;
+
+            uint64_t linear_type = (~b_zero & OneRoot) | (b_zero & c_zero & InfRoots);
+            uint64_t square_type = (dscr_positive & TwoRoots) | (dscr_zero & OneRoot);
+            uint64_t type = (a_zero & linear_type) | (~a_zero & square_type);
+
+            x1[i] = select_double(make_mask((type == OneRoot) | (type == TwoRoots)), root_x1 + 0.0, 0);
+            x2[i] = select_double(make_mask(type == TwoRoots), root_x2 + 0.0, 0);
+            result_type[i] = type;
+        }
+
+        for (size_t i = 0; i < block_size; i++) {
+            results[start + i].x1 = x1[i];
+            results[start + i].x2 = x2[i];
+            results[start + i].result_type = (RootNumber) result_type[i];
+        }
+    }
+}
@@ -14,6 +14,8 @@
  * - @ref solve_linear_equation "solve_linear_equation"     .
  * - @ref solve_square_equation "solve_square_equation"     .
  * - @ref print_solution "print_solution"   .
+ * - @ref run_follow_mode "run_follow_mode"      .
+ * - @ref run_command_line "run_command_line"       .
  * - @ref main "main"     .
  *
  * @note :  @ref get_number_input "get_number_input"     ,     .
@@ -30,6 +32,8 @@
 #include "solver.h"
 #include "input_output_solver.h"
 #include "testmode_solver.h"
+#include "follow_solver.h"
+#include "command_line.h"
 #include "error_code.h"
 
 /**
@@ -37,33 +41,44 @@
  * @brief    .
  *
  * @details
- *     :
+ *     :
  * - @ref TestMode "TestMode"    .
  * - @ref SolverMode "SolverMode"    .
+ * - @ref FollowMode "FollowMode"      .
  */
 enum ChoiceMode {
     TestMode = 1,
     SolverMode,
+    FollowMode,
 };
 
 /**
  * @brief   .
  *
  * @details
- *       ,  
+ *     ,    @ref run_command_line "run_command_line",
+ *    ,    .    
+ *    ,  
  *     ,      
- *    ,     .
+ *   ,         .
  *
+ * @param[in] argc    .
+ * @param[in] argv   .
  * @return  0    ,  
  *          ,   ERROR_CODE.
  */
-int main() {
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        return run_command_line(argc, argv);
+    }
+
     setlocale(LC_ALL, "Rus");
 
     int choice = 0;
     puts("   :\n"
          "1.  \n"
          "2.   \n"
+         "3.    \n"
          "  : ");
     if (scanf("%d", &choice) != 1) {
         printf(" .\n");
@@ -87,8 +102,14 @@ int main() {
             break;
         }
 
+        case FollowMode:
+            if (run_follow_mode() != SUCCESS) {
+                return ERROR_CODE;
+            }
+            break;
+
         default:
-            fprintf(stderr, "  . ,  1  2.\n");
+            fprintf(stderr, "  . ,  1, 2  3.\n");
             return ERROR_CODE;
     }
 
@@ -0,0 +1,442 @@
+/**
+ * @file packed_results.cpp
+ * @brief Компактный двоичный формат файлов результатов.
+ *
+ * @details
+ * Этот файл содержит кодирование и потоковое декодирование упакованных результатов.
+ * Каждый блок обрабатывается несколькими простыми проходами по массивам, без ветвлений
+ * по типу записи, чтобы компилятор мог их векторизовать:
+ * - кодирование: сбор типов и существующих корней в плотные массивы, упаковка типов
+ *   по 4 в байт, подсчет непредставимых значений и преобразование корней в float32
+ *   или в целые числа с масштабом;
+ * - декодирование: распаковка типов, обратное преобразование корней в double,
+ *   раскладка корней по записям.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+
+#include <math.h>
+#include <float.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "packed_results.h"
+#include "branchless_select.h"
+#include "error_code.h"
+
+/**
+ * @brief Сигнатура упакованного файла.
+ */
+const unsigned char PACKED_MAGIC[4] = { 'S', 'Q', 'P', 'K' };
+
+/**
+ * @brief Версия упакованного формата.
+ */
+const unsigned char PACKED_VERSION = 1;
+
+/**
+ * @brief Наибольшее по модулю значение корня с масштабом, которое хранится целым числом 32 бита.
+ */
+const double PACKED_FIXED32_LIMIT = 2147483647.0;
+
+/**
+ * @brief Масштабы корней для каждой допустимой точности.
+ */
+static const double PACKED_SCALES[PACKED_MAX_PRECISION + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9
+};
+
+/**
+ * @brief Записывает 32-битное число в буфер.
+ *
+ * @param[out] buffer Буфер.
+ * @param[in]  value  Число.
+ */
+static inline void store_u32(unsigned char* buffer, uint32_t value) {
+    memcpy(buffer, &value, sizeof(value));
+}
+
+/**
+ * @brief Читает 32-битное число из буфера.
+ *
+ * @param[in] buffer Буфер.
+ * @return Прочитанное число.
+ */
+static inline uint32_t load_u32(const unsigned char* buffer) {
+    uint32_t value = 0;
+    memcpy(&value, buffer, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Возвращает размер одного корня в байтах.
+ *
+ * @param[in] roots Способ хранения корней.
+ * @return Размер корня.
+ */
+static inline size_t packed_root_size(PackedRoots roots) {
+    return roots == PACKED_ROOTS_FLOAT64 ? sizeof(double) : sizeof(uint32_t);
+}
+
+/**
+ * @brief Собирает типы результатов и существующие корни в плотные массивы.
+ *
+ * @details
+ * Каждый корень записывается в следующую позицию, а позиция сдвигается, только если
+ * корень существует, поэтому в цикле нет ветвлений по типу записи.
+ *
+ * @param[in]  results Массив результатов.
+ * @param[in]  count   Количество результатов.
+ * @param[out] types   Массив типов.
+ * @param[out] roots   Массив корней размером не менее 2 * count.
+ * @return Количество существующих корней.
+ */
+static size_t gather_roots(const SquareEquationResult* results, size_t count, unsigned char* types, double* roots) {
+    size_t num_roots = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        unsigned char type = (unsigned char) (results[i].result_type & 3);
+        size_t has_x1 = type == OneRoot || type == TwoRoots;
+        size_t has_x2 = type == TwoRoots;
+
+        types[i] = type;
+        roots[num_roots] = results[i].x1;
+        num_roots += has_x1;
+        roots[num_roots] = results[i].x2;
+        num_roots += has_x2;
+    }
+    return num_roots;
+}
+
+/**
+ * @brief Упаковывает типы по 4 в байт.
+ *
+ * @param[in]  types  Массив типов, дополненный нулями до кратного 4 размера.
+ * @param[in]  count  Количество типов.
+ * @param[out] bitmap Битовая карта размером (count + 3) / 4 байт.
+ */
+static void pack_types(const unsigned char* types, size_t count, unsigned char* bitmap) {
+    for (size_t i = 0; i < (count + 3) / 4; i++) {
+        bitmap[i] = (unsigned char) (types[4 * i] | types[4 * i + 1] << 2 |
+                                     types[4 * i + 2] << 4 | types[4 * i + 3] << 6);
+    }
+}
+
+/**
+ * @brief Распаковывает типы из битовой карты.
+ *
+ * @param[in]  bitmap Битовая карта.
+ * @param[in]  count  Количество типов.
+ * @param[out] types  Массив типов размером не менее count, округленного вверх до кратного 4.
+ */
+static void unpack_types(const unsigned char* bitmap, size_t count, unsigned char* types) {
+    for (size_t i = 0; i < (count + 3) / 4; i++) {
+        types[4 * i]     = bitmap[i] & 3;
+        types[4 * i + 1] = (bitmap[i] >> 2) & 3;
+        types[4 * i + 2] = (bitmap[i] >> 4) & 3;
+        types[4 * i + 3] = (bitmap[i] >> 6) & 3;
+    }
+}
+
+/**
+ * @brief Преобразует корни в float32.
+ *
+ * @details
+ * Переполнение проверяется уже по значениям float32, чтобы сравнения выполнялись
+ * над элементами той же ширины, что и счетчик, и цикл векторизовался без AVX2.
+ * Ненулевой корень, который в float32 становится нулем, тоже считается непредставимым.
+ *
+ * @param[in]  roots     Массив корней.
+ * @param[in]  num_roots Количество корней.
+ * @param[out] values    Массив значений float32.
+ * @return true, если все корни представимы в float32.
+ */
+static bool quantize_float32(const double* roots, size_t num_roots, float* values) {
+    for (size_t i = 0; i < num_roots; i++) {
+        values[i] = (float) roots[i];
+    }
+
+    int num_overflows = 0;
+    for (size_t i = 0; i < num_roots; i++) {
+        num_overflows += fabsf(values[i]) > FLT_MAX;
+    }
+
+    int num_underflows = 0;
+    for (size_t i = 0; i < num_roots; i++) {
+        num_underflows += (values[i] == 0.0f) != (roots[i] == 0.0);
+    }
+    return num_overflows == 0 && num_underflows == 0;
+}
+
+/**
+ * @brief Вычисляет ошибку округления произведения двух чисел.
+ *
+ * @details
+ * Алгоритм Деккера: множители разбиваются на половины по 26 бит, произведения половин
+ * точны, поэтому x * y = round(x * y) + результат точно (если нет переполнения
+ * и потери значимости). FMA не используется, чтобы цикл векторизовался без -mfma.
+ *
+ * @param[in] x       Первый множитель.
+ * @param[in] y       Второй множитель.
+ * @param[in] product Округленное произведение x * y.
+ * @return Точная разность x * y - product.
+ */
+static inline double product_error(double x, double y, double product) {
+    const double split = 134217729.0; // 2^27 + 1
+
+    double x_split = split * x;
+    double x_high = x_split - (x_split - x);
+    double x_low = x - x_high;
+    double y_split = split * y;
+    double y_high = y_split - (y_split - y);
+    double y_low = y - y_high;
+
+    return ((x_high * y_high - product) + x_high * y_low + x_low * y_high) + x_low * y_low;
+}
+
+/**
+ * @brief Преобразует корни в целые числа с масштабом и округлением до ближайшего.
+ *
+ * @details
+ * Сначала проверяется, что все корни с масштабом помещаются в 32 бита (NaN не помещается),
+ * и только затем выполняется преобразование, поэтому в цикле преобразования нет условий.
+ * Счетчик переполнений имеет тип double, чтобы он совпадал по ширине со сравниваемыми значениями.
+ *
+ * Округляется точное значение root * scale, половина - к четному, как в printf("%.*f"),
+ * поэтому декодированный корень печатается с той же точностью так же, как в текстовом выводе.
+ * Произведение root * scale округляется к ближайшему четному с помощью nearbyint; если оно
+ * оказалось ровно посередине между целыми, знак ошибки округления произведения
+ * (@ref product_error) показывает, в какую сторону от середины лежит точное значение.
+ * При |root * scale| < 2^31 ошибка меньше половины ulp, поэтому в остальных случаях
+ * nearbyint уже дает правильный результат. Поправка выбирается по целочисленной маске, и цикл
+ * преобразования векторизуется начиная с SSE4.2 (nearbyint требует roundpd, маски - pcmpgtq).
+ *
+ * @param[in]  roots     Массив корней.
+ * @param[in]  num_roots Количество корней.
+ * @param[in]  scale     Масштаб 10^precision.
+ * @param[out] values    Массив целых значений.
+ * @return true, если все корни с масштабом помещаются в 32 бита.
+ */
+static bool quantize_fixed32(const double* roots, size_t num_roots, double scale, int32_t* values) {
+    double num_overflows = 0;
+    for (size_t i = 0; i < num_roots; i++) {
+        num_overflows += fabs(roots[i] * scale) < PACKED_FIXED32_LIMIT ? 0.0 : 1.0;
+    }
+    if (num_overflows > 0) {
+        return false;
+    }
+
+    for (size_t i = 0; i < num_roots; i++) {
+        double scaled = roots[i] * scale;
+        double rounded = nearbyint(scaled);
+        double fraction = scaled - rounded;
+        double error = product_error(roots[i], scale, scaled);
+        uint64_t away_from_tie = make_mask((fabs(fraction) == 0.5) & (error * fraction > 0));
+        rounded += select_double(away_from_tie, 2 * fraction, 0.0);
+        values[i] = (int32_t) rounded;
+    }
+    return true;
+}
+
+/**
+ * @brief Раскладывает плотный массив корней по записям.
+ *
+ * @param[in]  types   Массив типов.
+ * @param[in]  roots   Массив корней, дополненный двумя нулями после последнего корня.
+ * @param[in]  count   Количество записей.
+ * @param[out] results Массив результатов.
+ */
+static void scatter_roots(const unsigned char* types, const double* roots, size_t count,
+                          SquareEquationResult* results) {
+    size_t position = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        size_t has_x1 = types[i] == OneRoot || types[i] == TwoRoots;
+        size_t has_x2 = types[i] == TwoRoots;
+
+        results[i].x1 = has_x1 ? roots[position] : 0;
+        position += has_x1;
+        results[i].x2 = has_x2 ? roots[position] : 0;
+        position += has_x2;
+        results[i].result_type = (RootNumber) types[i];
+    }
+}
+
+/**
+ * @brief Записывает заголовок упакованного файла в буфер.
+ *
+ * @param[in]  encoding Параметры формата.
+ * @param[out] buffer   Буфер размером не менее PACKED_FILE_HEADER_SIZE байт.
+ * @return Количество записанных байт.
+ */
+size_t write_packed_header(const PackedEncoding* encoding, unsigned char* buffer) {
+    assert(encoding != NULL);
+    assert(buffer != NULL);
+    assert(encoding->precision <= PACKED_MAX_PRECISION);
+
+    memcpy(buffer, PACKED_MAGIC, sizeof(PACKED_MAGIC));
+    buffer[4] = PACKED_VERSION;
+    buffer[5] = (unsigned char) encoding->roots;
+    buffer[6] = (unsigned char) encoding->precision;
+    buffer[7] = 0;
+    return PACKED_FILE_HEADER_SIZE;
+}
+
+/**
+ * @brief Кодирует блок результатов.
+ *
+ * @details
+ * Если хотя бы один корень блока не представим выбранным способом, корни блока
+ * записываются в виде double.
+ *
+ * @param[in]  encoding Параметры формата.
+ * @param[in]  results  Массив результатов.
+ * @param[in]  count    Количество результатов, не более PACKED_BLOCK_SIZE.
+ * @param[out] buffer   Буфер размером не менее PACKED_MAX_BLOCK_BYTES байт.
+ * @return Количество записанных байт.
+ */
+size_t encode_packed_block(const PackedEncoding* encoding, const SquareEquationResult* results,
+                           size_t count, unsigned char* buffer) {
+    assert(encoding != NULL);
+    assert(results != NULL || count == 0);
+    assert(buffer != NULL);
+    assert(count <= PACKED_BLOCK_SIZE);
+
+    unsigned char types[PACKED_BLOCK_SIZE + 3] = {};
+    double roots[2 * PACKED_BLOCK_SIZE];
+    size_t num_roots = gather_roots(results, count, types, roots);
+
+    size_t bitmap_size = (count + 3) / 4;
+    unsigned char* root_data = buffer + PACKED_BLOCK_HEADER_SIZE + bitmap_size;
+    pack_types(types, count, buffer + PACKED_BLOCK_HEADER_SIZE);
+
+    PackedRoots block_roots = encoding->roots;
+    if (block_roots == PACKED_ROOTS_FLOAT32) {
+        float values[2 * PACKED_BLOCK_SIZE];
+        if (quantize_float32(roots, num_roots, values)) {
+            memcpy(root_data, values, num_roots * sizeof(values[0]));
+        } else {
+            block_roots = PACKED_ROOTS_FLOAT64;
+        }
+    } else if (block_roots == PACKED_ROOTS_FIXED32) {
+        int32_t values[2 * PACKED_BLOCK_SIZE];
+        if (quantize_fixed32(roots, num_roots, PACKED_SCALES[encoding->precision], values)) {
+            memcpy(root_data, values, num_roots * sizeof(values[0]));
+        } else {
+            block_roots = PACKED_ROOTS_FLOAT64;
+        }
+    }
+    if (block_roots == PACKED_ROOTS_FLOAT64) {
+        memcpy(root_data, roots, num_roots * sizeof(roots[0]));
+    }
+
+    store_u32(buffer, (uint32_t) count);
+    store_u32(buffer + 4, (uint32_t) num_roots);
+    buffer[8] = (unsigned char) block_roots;
+    buffer[9] = buffer[10] = buffer[11] = 0;
+    return PACKED_BLOCK_HEADER_SIZE + bitmap_size + num_roots * packed_root_size(block_roots);
+}
+
+/**
+ * @brief Начинает чтение упакованного файла и проверяет его заголовок.
+ *
+ * @param[out] reader Состояние чтения.
+ * @param[in]  input  Входной файл, открытый в двоичном режиме.
+ * @return SUCCESS, если заголовок корректен, иначе ERROR_CODE.
+ */
+int open_packed_reader(PackedReader* reader, FILE* input) {
+    assert(reader != NULL);
+    assert(input != NULL);
+
+    unsigned char header[PACKED_FILE_HEADER_SIZE] = {};
+    if (fread(header, 1, sizeof(header), input) != sizeof(header) ||
+        memcmp(header, PACKED_MAGIC, sizeof(PACKED_MAGIC)) != 0 || header[4] != PACKED_VERSION ||
+        (header[5] != PACKED_ROOTS_FLOAT32 && header[5] != PACKED_ROOTS_FIXED32) ||
+        header[6] > PACKED_MAX_PRECISION) {
+        return ERROR_CODE;
+    }
+
+    reader->input = input;
+    reader->encoding.roots = (PackedRoots) header[5];
+    reader->encoding.precision = header[6];
+    return SUCCESS;
+}
+
+/**
+ * @brief Читает и декодирует следующий блок упакованного файла.
+ *
+ * @details
+ * Блок читается целиком в рабочие массивы на стеке, поэтому память при чтении файла
+ * любого размера не растет. Количество корней из заголовка блока сверяется
+ * с количеством, которое следует из типов записей.
+ *
+ * @param[in,out] reader  Состояние чтения.
+ * @param[out]    results Массив результатов размером не менее PACKED_BLOCK_SIZE.
+ * @param[out]    count   Количество декодированных результатов.
+ * @return SUCCESS при успехе, ERROR_CODE при ошибке чтения или поврежденном блоке.
+ */
+int read_packed_block(PackedReader* reader, SquareEquationResult* results, size_t* count) {
+    assert(reader != NULL);
+    assert(results != NULL);
+    assert(count != NULL);
+
+    *count = 0;
+    unsigned char header[PACKED_BLOCK_HEADER_SIZE] = {};
+    size_t header_size = fread(header, 1, sizeof(header), reader->input);
+    if (header_size == 0 && feof(reader->input)) {
+        return SUCCESS;
+    }
+
+    size_t block_count = load_u32(header);
+    size_t num_roots = load_u32(header + 4);
+    PackedRoots block_roots = (PackedRoots) header[8];
+    if (header_size != sizeof(header) || block_count == 0 || block_count > PACKED_BLOCK_SIZE ||
+        num_roots > 2 * block_count || (block_roots != reader->encoding.roots && block_roots != PACKED_ROOTS_FLOAT64)) {
+        return ERROR_CODE;
+    }
+
+    unsigned char bitmap[PACKED_BLOCK_SIZE / 4];
+    unsigned char root_data[2 * PACKED_BLOCK_SIZE * sizeof(double)];
+    size_t bitmap_size = (block_count + 3) / 4;
+    size_t root_data_size = num_roots * packed_root_size(block_roots);
+    if (fread(bitmap, 1, bitmap_size, reader->input) != bitmap_size ||
+        fread(root_data, 1, root_data_size, reader->input) != root_data_size) {
+        return ERROR_CODE;
+    }
+
+    unsigned char types[PACKED_BLOCK_SIZE + 3];
+    unpack_types(bitmap, block_count, types);
+
+    size_t expected_roots = 0;
+    for (size_t i = 0; i < block_count; i++) {
+        expected_roots += (types[i] == OneRoot || types[i] == TwoRoots) + (types[i] == TwoRoots);
+    }
+    if (expected_roots != num_roots) {
+        return ERROR_CODE;
+    }
+
+    double roots[2 * PACKED_BLOCK_SIZE + 2];
+    if (block_roots == PACKED_ROOTS_FLOAT32) {
+        float values[2 * PACKED_BLOCK_SIZE];
+        memcpy(values, root_data, root_data_size);
+        for (size_t i = 0; i < num_roots; i++) {
+            roots[i] = values[i];
+        }
+    } else if (block_roots == PACKED_ROOTS_FIXED32) {
+        int32_t values[2 * PACKED_BLOCK_SIZE];
+        double scale = PACKED_SCALES[reader->encoding.precision];
+        memcpy(values, root_data, root_data_size);
+        for (size_t i = 0; i < num_roots; i++) {
+            roots[i] = values[i] / scale;
+        }
+    } else {
+        memcpy(roots, root_data, root_data_size);
+    }
+    roots[num_roots] = 0;
+    roots[num_roots + 1] = 0;
+
+    scatter_roots(types, roots, block_count, results);
+    *count = block_count;
+    return SUCCESS;
+}
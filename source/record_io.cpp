@@ -0,0 +1,120 @@
+/**
+ * @file record_io.cpp
+ * @brief Разбор и форматирование строковых записей квадратных уравнений.
+ *
+ * @details
+ * Этот файл содержит функции для неинтерактивных режимов программы: разбор строки
+ * с коэффициентами уравнения и форматирование результата решения в одну строку.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <assert.h>
+#include "record_io.h"
+#include "error_code.h"
+
+/**
+ * @brief Разбирает строку с коэффициентами квадратного уравнения.
+ *
+ * @details
+ * Строка копируется во временный буфер, чтобы strtod не вышла за ее пределы,
+ * после чего последовательно считываются три числа. Любые символы, кроме пробельных,
+ * после третьего числа считаются ошибкой.
+ *
+ * @param[in]  line    Указатель на начало строки.
+ * @param[in]  length  Длина строки без символа перевода строки.
+ * @param[out] coeffts Указатель на структуру, в которую будут сохранены коэффициенты.
+ * @return SUCCESS при успешном разборе, иначе ERROR_CODE.
+ */
+int parse_coefficients_line(const char* line, size_t length, SquareEquationCoefficient* coeffts) {
+    assert(line != NULL);
+    assert(coeffts != NULL);
+
+    if (length >= MAX_INPUT_LINE_LENGTH) {
+        return ERROR_CODE;
+    }
+
+    char text[MAX_INPUT_LINE_LENGTH] = "";
+    memcpy(text, line, length);
+    text[length] = '\0';
+
+    double* coeffs[] = { &coeffts->a, &coeffts->b, &coeffts->c };
+    const char* position = text;
+
+    for (size_t i = 0; i < sizeof(coeffs) / sizeof(coeffs[0]); i++) {
+        char* end = NULL;
+        *coeffs[i] = strtod(position, &end);
+        if (end == position) {
+            return ERROR_CODE;
+        }
+        position = end;
+    }
+
+    while (isspace((unsigned char) *position)) {
+        position++;
+    }
+    return *position == '\0' ? SUCCESS : ERROR_CODE;
+}
+
+/**
+ * @brief Форматирует результат решения квадратного уравнения в одну строку.
+ *
+ * @details
+ * Коэффициенты выводятся с 17 значащими цифрами, чтобы по записи однозначно восстанавливались
+ * исходные значения double. Корни выводятся с двумя знаками после запятой, как и в @ref print_solution.
+ * MAX_RECORD_LENGTH рассчитана на самые длинные значения, поэтому запись не обрезается;
+ * если это все же произойдет, последним символом записи остается перевод строки.
+ *
+ * @param[out] buffer  Буфер для записи, размером не менее MAX_RECORD_LENGTH.
+ * @param[in]  format  Формат записи.
+ * @param[in]  coeffts Коэффициенты решенного уравнения.
+ * @param[in]  result  Результат решения уравнения.
+ * @return Количество записанных символов без завершающего нуля.
+ */
+size_t format_solution_record(char* buffer, RecordFormat format,
+                              SquareEquationCoefficient coeffts, SquareEquationResult result) {
+    assert(buffer != NULL);
+
+    const char* const TEXT_FORMATS[] = {
+        "%.17g %.17g %.17g %d\n",
+        "%.17g %.17g %.17g %d %.2f\n",
+        "%.17g %.17g %.17g %d %.2f %.2f\n"
+    };
+    const char* const CSV_FORMATS[] = {
+        "%.17g,%.17g,%.17g,%d,,\n",
+        "%.17g,%.17g,%.17g,%d,%.2f,\n",
+        "%.17g,%.17g,%.17g,%d,%.2f,%.2f\n"
+    };
+    const char* const* formats = format == RECORD_CSV ? CSV_FORMATS : TEXT_FORMATS;
+
+    int length = 0;
+    switch (result.result_type) {
+        case TwoRoots:
+            length = snprintf(buffer, MAX_RECORD_LENGTH, formats[2],
+                              coeffts.a, coeffts.b, coeffts.c, result.result_type, result.x1, result.x2);
+            break;
+        case OneRoot:
+            length = snprintf(buffer, MAX_RECORD_LENGTH, formats[1],
+                              coeffts.a, coeffts.b, coeffts.c, result.result_type, result.x1);
+            break;
+        default:
+            length = snprintf(buffer, MAX_RECORD_LENGTH, formats[0],
+                              coeffts.a, coeffts.b, coeffts.c, result.result_type);
+            break;
+    }
+
+    if (length < 0) {
+        buffer[0] = '\0';
+        return 0;
+    }
+    if ((size_t) length >= MAX_RECORD_LENGTH) {
+        buffer[MAX_RECORD_LENGTH - 2] = '\n';
+        return MAX_RECORD_LENGTH - 1;
+    }
+    return (size_t) length;
+}
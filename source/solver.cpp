@@ -13,19 +13,31 @@
  * - @ref calculate_dscr "calculate_dscr" для вычисления дискриминанта квадратного уравнения.
  * - @ref solve_linear_equation "solve_linear_equation" для решения линейного уравнения.
  * - @ref solve_square_equation "solve_square_equation" для решения квадратного уравнения.
+ * - @ref solve_square_equation_branchless "solve_square_equation_branchless" для решения квадратного уравнения без переходов.
+ * - @ref solve_square_equations "solve_square_equations" для решения пакета квадратных уравнений.
+ * - @ref solve_square_equations_soa "solve_square_equations_soa" для решения пакета, заданного отдельными массивами.
+ *
+ * Файл не использует ввод-вывод и динамическую память и входит в библиотеку вместе с
+ * int_solver.cpp, comparison_with_zero.cpp и sqsolver.cpp.
  *
  * @author Арина Прорешина
  * @date 20.08.2024
  */
 
-#include <stdio.h>
-#include <stdlib.h>
 #include <math.h>
+#include <stdint.h>
 #include <assert.h>
 #include <stdbool.h>
 #include "solver.h"
 #include "error_code.h"
 #include "comparison_with_zero.h"
+#include "int_solver.h"
+#include "branchless_select.h"
+
+/**
+ * @brief Размер блока, на которые разбивается пакет уравнений при распределении по типу коэффициентов.
+ */
+const size_t SOLVER_BLOCK_SIZE = 256;
 
 /**
  * @brief Вычисляет дискриминант квадратного уравнения.
@@ -102,3 +114,162 @@ SquareEquationResult solve_square_equation(SquareEquationCoefficient coeffts) {
     }
     return result;
 }
+
+/**
+ * @brief Решает квадратное уравнение вида ax^2 + bx + c = 0 без условных переходов.
+ *
+ * @details
+ * Корень линейного уравнения и оба корня квадратного вычисляются всегда, причем корень
+ * берется из дискриминанта, замененного нулем, если он не положителен, а деление на нулевой коэффициент дает бесконечность или NaN,
+ * которые затем отбрасываются маской. Сравнения превращаются в флаги 0/1, из которых
+ * арифметически собирается тип результата, а корни выбираются побитово по маскам.
+ * Деление на 2a заменено умножением на обратное число, которое вычисляется параллельно
+ * с корнем из дискриминанта, поэтому корни могут отличаться от @ref solve_square_equation
+ * в последнем знаке. При нулевом дискриминанте первым корнем становится -b / 2a.
+ * Компилятор может оставить только переход к установке errno в sqrt, который
+ * для неотрицательного аргумента никогда не выполняется и всегда предсказывается верно.
+ *
+ * @param[in] coeffts Структура, содержащая коэффициенты квадратного уравнения.
+ * @return Структура CompactSquareEquationResult, отсутствующие корни равны 0.
+ */
+CompactSquareEquationResult solve_square_equation_branchless(SquareEquationCoefficient coeffts) {
+    double a = coeffts.a;
+    double b = coeffts.b;
+    double c = coeffts.c;
+
+    uint64_t a_zero = fabs(a) < EPSILON;
+    uint64_t b_zero = fabs(b) < EPSILON;
+    uint64_t c_zero = fabs(c) < EPSILON;
+
+    double dscr = calculate_dscr(a, b, c);
+    uint64_t dscr_positive = dscr > 0;
+    uint64_t dscr_zero = dscr == 0;
+    double dscr_sqrt = sqrt(select_double(make_mask(dscr_positive), dscr, 0));
+
+    double linear_root = -c / b;
+    double inverse_2a = 1 / (2 * a);
+    double square_x1 = (-b + dscr_sqrt) * inverse_2a;
+    double square_x2 = (-b - dscr_sqrt) * inverse_2a;
+
+    uint64_t linear_type = (1 - b_zero) * OneRoot + b_zero * c_zero * InfRoots;
+    uint64_t square_type = dscr_positive * TwoRoots + dscr_zero * OneRoot;
+    uint64_t result_type = (linear_type & make_mask(a_zero)) | (square_type & ~make_mask(a_zero));
+
+    uint64_t has_x1 = (result_type == OneRoot) | (result_type == TwoRoots);
+    uint64_t has_x2 = result_type == TwoRoots;
+
+    CompactSquareEquationResult result = {};
+    result.x1 = select_double(make_mask(has_x1), select_double(make_mask(a_zero), linear_root, square_x1), 0);
+    result.x2 = select_double(make_mask(has_x2), square_x2, 0);
+    result.result_type = (unsigned char) result_type;
+    return result;
+}
+
+/**
+ * @brief Решает пакет квадратных уравнений, заданный отдельными массивами (SoA).
+ *
+ * @details
+ * Пакет обрабатывается блоками по SOLVER_BLOCK_SIZE уравнений, которые распределяются по типу
+ * коэффициентов. Уравнения с небольшими целыми коэффициентами собираются в рабочие массивы на стеке
+ * и решаются без ветвлений @ref solve_small_int_square_equations (флаги сборки, при которых он
+ * векторизуется, указаны в его описании), остальные уравнения с целыми
+ * коэффициентами решаются точно @ref solve_int_square_equation, а прочие - @ref solve_square_equation.
+ *
+ * @param[in]  a           Массив коэффициентов a.
+ * @param[in]  b           Массив коэффициентов b.
+ * @param[in]  c           Массив коэффициентов c.
+ * @param[out] x1          Массив первых корней.
+ * @param[out] x2          Массив вторых корней.
+ * @param[out] result_type Массив типов результата.
+ * @param[in]  count       Количество уравнений в пакете.
+ */
+void solve_square_equations_soa(const double* a, const double* b, const double* c,
+                                double* x1, double* x2, unsigned char* result_type, size_t count) {
+    assert(count == 0 || (a != NULL && b != NULL && c != NULL));
+    assert(count == 0 || (x1 != NULL && x2 != NULL && result_type != NULL));
+
+    size_t small_index[SOLVER_BLOCK_SIZE];
+    double small_a[SOLVER_BLOCK_SIZE];
+    double small_b[SOLVER_BLOCK_SIZE];
+    double small_c[SOLVER_BLOCK_SIZE];
+    SquareEquationResult small_results[SOLVER_BLOCK_SIZE];
+
+    for (size_t start = 0; start < count; start += SOLVER_BLOCK_SIZE) {
+        size_t end = count - start < SOLVER_BLOCK_SIZE ? count : start + SOLVER_BLOCK_SIZE;
+        size_t num_small = 0;
+
+        for (size_t i = start; i < end; i++) {
+            SquareEquationCoefficient coeffts = { a[i], b[i], c[i] };
+            IntSquareEquationCoefficient int_coeffts = {0, 0, 0};
+            SquareEquationResult result = {0, 0, NoRoots};
+
+            if (is_small_int_coefficient(coeffts)) {
+                small_index[num_small] = i;
+                small_a[num_small] = a[i];
+                small_b[num_small] = b[i];
+                small_c[num_small] = c[i];
+                num_small++;
+                continue;
+            } else if (is_int_coefficient(coeffts, &int_coeffts)) {
+                ExactSquareEquationResult exact;
+                solve_int_square_equation(int_coeffts, &exact);
+                result = exact.result;
+            } else {
+                result = solve_square_equation(coeffts);
+            }
+
+            x1[i] = result.result_type != NoRoots && result.result_type != InfRoots ? result.x1 : 0;
+            x2[i] = result.result_type == TwoRoots ? result.x2 : 0;
+            result_type[i] = (unsigned char) result.result_type;
+        }
+
+        solve_small_int_square_equations(small_a, small_b, small_c, small_results, num_small);
+        for (size_t k = 0; k < num_small; k++) {
+            size_t i = small_index[k];
+            x1[i] = small_results[k].x1;
+            x2[i] = small_results[k].x2;
+            result_type[i] = (unsigned char) small_results[k].result_type;
+        }
+    }
+}
+
+/**
+ * @brief Решает пакет квадратных уравнений.
+ *
+ * @details
+ * Пакет разбивается на блоки по SOLVER_BLOCK_SIZE уравнений, коэффициенты каждого блока
+ * переносятся в отдельные массивы и решаются @ref solve_square_equations_soa.
+ *
+ * @param[in]  coeffts Массив коэффициентов уравнений.
+ * @param[out] results Массив для результатов, размером не менее count.
+ * @param[in]  count   Количество уравнений в пакете.
+ */
+void solve_square_equations(const SquareEquationCoefficient* coeffts, SquareEquationResult* results, size_t count) {
+    assert(coeffts != NULL || count == 0);
+    assert(results != NULL || count == 0);
+
+    double a[SOLVER_BLOCK_SIZE];
+    double b[SOLVER_BLOCK_SIZE];
+    double c[SOLVER_BLOCK_SIZE];
+    double x1[SOLVER_BLOCK_SIZE];
+    double x2[SOLVER_BLOCK_SIZE];
+    unsigned char result_type[SOLVER_BLOCK_SIZE];
+
+    for (size_t start = 0; start < count; start += SOLVER_BLOCK_SIZE) {
+        size_t block_size = count - start < SOLVER_BLOCK_SIZE ? count - start : SOLVER_BLOCK_SIZE;
+
+        for (size_t i = 0; i < block_size; i++) {
+            a[i] = coeffts[start + i].a;
+            b[i] = coeffts[start + i].b;
+            c[i] = coeffts[start + i].c;
+        }
+
+        solve_square_equations_soa(a, b, c, x1, x2, result_type, block_size);
+
+        for (size_t i = 0; i < block_size; i++) {
+            results[start + i].x1 = x1[i];
+            results[start + i].x2 = x2[i];
+            results[start + i].result_type = (RootNumber) result_type[i];
+        }
+    }
+}
@@ -0,0 +1,267 @@
+/**
+ * @file sqsolver.cpp
+ * @brief Реализация C API библиотеки решения квадратных уравнений.
+ *
+ * @details
+ * Этот файл содержит реализацию функций из sqsolver.h. Пакетное решение выполняется
+ * @ref solve_square_equations_soa прямо над массивами вызывающего кода. Большие пакеты делятся
+ * на части по PARALLEL_CHUNK_SIZE уравнений, которые разбирают рабочие потоки контекста
+ * и вызывающий поток. Рабочие массивы блоков размещаются на стеках потоков, поэтому
+ * пакетный вызов не выделяет память. Потоки и синхронизация реализованы на POSIX threads
+ * (в MinGW - winpthreads), а не на std::thread, чтобы библиотека и программа не зависели от libstdc++.
+ *
+ * @author Арина Прорешина
+ * @date 18.10.2026
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <atomic>
+#include "sqsolver.h"
+#include "solver.h"
+#include "processor_count.h"
+
+static_assert(SQSOLVER_NO_ROOTS == NoRoots && SQSOLVER_ONE_ROOT == OneRoot &&
+              SQSOLVER_TWO_ROOTS == TwoRoots && SQSOLVER_INF_ROOTS == InfRoots,
+              "Типы результата C API должны совпадать с RootNumber");
+
+/**
+ * @brief Количество уравнений в одной части пакета, обрабатываемой потоком за раз.
+ */
+const size_t PARALLEL_CHUNK_SIZE = 4096;
+
+/**
+ * @brief Минимальный размер пакета, который имеет смысл делить между потоками.
+ */
+const size_t PARALLEL_MIN_COUNT = 4 * PARALLEL_CHUNK_SIZE;
+
+/**
+ * @struct sqsolver_context
+ * @brief Структура контекста библиотеки с пулом потоков и текущим заданием.
+ */
+struct sqsolver_context {
+    pthread_t* workers;                  /**< Рабочие потоки. */
+    size_t num_workers;                  /**< Количество запущенных рабочих потоков. */
+    pthread_mutex_t call_mutex;          /**< Упорядочивает пакетные вызовы с этим контекстом. */
+    pthread_mutex_t mutex;               /**< Защищает поля задания и состояния пула. */
+    pthread_cond_t work_ready;           /**< Сигнал о новом задании или остановке. */
+    pthread_cond_t work_done;            /**< Сигнал о завершении задания всеми потоками. */
+    unsigned long long generation;       /**< Номер текущего задания. */
+    size_t active_workers;               /**< Количество потоков, еще не завершивших задание. */
+    bool stopping;                       /**< Запрошена ли остановка потоков. */
+
+    const double* a;                     /**< Коэффициенты a текущего задания. */
+    const double* b;                     /**< Коэффициенты b текущего задания. */
+    const double* c;                     /**< Коэффициенты c текущего задания. */
+    double* x1;                          /**< Первые корни текущего задания. */
+    double* x2;                          /**< Вторые корни текущего задания. */
+    unsigned char* result_type;          /**< Типы результата текущего задания. */
+    size_t count;                        /**< Количество уравнений текущего задания. */
+    std::atomic<size_t> next_chunk;      /**< Начало следующей необработанной части. */
+};
+
+/**
+ * @brief Обрабатывает части текущего задания, пока они не закончатся.
+ *
+ * @param[in] context Контекст с текущим заданием.
+ */
+static void run_chunks(sqsolver_context* context) {
+    for (;;) {
+        size_t start = context->next_chunk.fetch_add(PARALLEL_CHUNK_SIZE);
+        if (start >= context->count) {
+            return;
+        }
+
+        size_t size = context->count - start < PARALLEL_CHUNK_SIZE ? context->count - start : PARALLEL_CHUNK_SIZE;
+        solve_square_equations_soa(context->a + start, context->b + start, context->c + start,
+                                   context->x1 + start, context->x2 + start, context->result_type + start, size);
+    }
+}
+
+/**
+ * @brief Основной цикл рабочего потока.
+ *
+ * @param[in] argument Контекст, которому принадлежит поток.
+ * @return NULL.
+ */
+static void* worker_loop(void* argument) {
+    sqsolver_context* context = (sqsolver_context*) argument;
+    unsigned long long seen_generation = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&context->mutex);
+        while (!context->stopping && context->generation == seen_generation) {
+            pthread_cond_wait(&context->work_ready, &context->mutex);
+        }
+        if (context->stopping) {
+            pthread_mutex_unlock(&context->mutex);
+            return NULL;
+        }
+        seen_generation = context->generation;
+        pthread_mutex_unlock(&context->mutex);
+
+        run_chunks(context);
+
+        pthread_mutex_lock(&context->mutex);
+        if (--context->active_workers == 0) {
+            pthread_cond_signal(&context->work_done);
+        }
+        pthread_mutex_unlock(&context->mutex);
+    }
+}
+
+/**
+ * @brief Возвращает версию C API, с которой собрана библиотека.
+ *
+ * @return SQSOLVER_API_VERSION библиотеки.
+ */
+int sqsolver_api_version(void) {
+    return SQSOLVER_API_VERSION;
+}
+
+/**
+ * @brief Решает одно квадратное уравнение ax^2 + bx + c = 0.
+ *
+ * @details
+ * Результат совпадает с результатом @ref sqsolver_solve_batch для того же уравнения:
+ * уравнения с целыми коэффициентами решаются точно, без EPSILON.
+ *
+ * @param[in]  a      Коэффициент при x^2.
+ * @param[in]  b      Коэффициент при x.
+ * @param[in]  c      Свободный член.
+ * @param[out] result Указатель на структуру для результата.
+ * @return SQSOLVER_OK при успехе, SQSOLVER_ERROR, если result равен NULL.
+ */
+int sqsolver_solve(double a, double b, double c, sqsolver_result* result) {
+    if (result == NULL) {
+        return SQSOLVER_ERROR;
+    }
+
+    unsigned char result_type = SQSOLVER_NO_ROOTS;
+    solve_square_equations_soa(&a, &b, &c, &result->x1, &result->x2, &result_type, 1);
+    result->result_type = result_type;
+    return SQSOLVER_OK;
+}
+
+/**
+ * @brief Создает контекст для пакетного решения.
+ *
+ * @param[in] num_threads Количество потоков, 0 - по числу процессоров.
+ * @return Указатель на контекст или NULL при ошибке.
+ */
+sqsolver_context* sqsolver_create(unsigned num_threads) {
+    if (num_threads == 0) {
+        num_threads = count_processors();
+    }
+
+    sqsolver_context* context = (sqsolver_context*) calloc(1, sizeof(sqsolver_context));
+    if (context == NULL) {
+        return NULL;
+    }
+    context->workers = (pthread_t*) calloc(num_threads, sizeof(pthread_t));
+    if (context->workers == NULL) {
+        free(context);
+        return NULL;
+    }
+    pthread_mutex_init(&context->call_mutex, NULL);
+    pthread_mutex_init(&context->mutex, NULL);
+    pthread_cond_init(&context->work_ready, NULL);
+    pthread_cond_init(&context->work_done, NULL);
+
+    for (unsigned i = 1; i < num_threads; i++) {
+        if (pthread_create(&context->workers[context->num_workers], NULL, worker_loop, context) != 0) {
+            sqsolver_destroy(context);
+            return NULL;
+        }
+        context->num_workers++;
+    }
+    return context;
+}
+
+/**
+ * @brief Останавливает потоки контекста и освобождает его.
+ *
+ * @param[in] context Контекст или NULL.
+ */
+void sqsolver_destroy(sqsolver_context* context) {
+    if (context == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&context->mutex);
+    context->stopping = true;
+    pthread_cond_broadcast(&context->work_ready);
+    pthread_mutex_unlock(&context->mutex);
+
+    for (size_t i = 0; i < context->num_workers; i++) {
+        pthread_join(context->workers[i], NULL);
+    }
+
+    pthread_cond_destroy(&context->work_done);
+    pthread_cond_destroy(&context->work_ready);
+    pthread_mutex_destroy(&context->mutex);
+    pthread_mutex_destroy(&context->call_mutex);
+    free(context->workers);
+    free(context);
+}
+
+/**
+ * @brief Решает пакет квадратных уравнений, заданный массивами вызывающего кода.
+ *
+ * @details
+ * Небольшие пакеты и пакеты без контекста решаются в вызывающем потоке. Иначе задание
+ * публикуется рабочим потокам, вызывающий поток обрабатывает части наравне с ними
+ * и ожидает, пока все потоки завершат задание.
+ *
+ * @param[in]  context     Контекст или NULL.
+ * @param[in]  a           Массив коэффициентов a.
+ * @param[in]  b           Массив коэффициентов b.
+ * @param[in]  c           Массив коэффициентов c.
+ * @param[out] x1          Массив первых корней.
+ * @param[out] x2          Массив вторых корней.
+ * @param[out] result_type Массив типов результата.
+ * @param[in]  count       Количество уравнений.
+ * @return SQSOLVER_OK при успехе, SQSOLVER_ERROR при некорректных аргументах.
+ */
+int sqsolver_solve_batch(sqsolver_context* context,
+                         const double* a, const double* b, const double* c,
+                         double* x1, double* x2, unsigned char* result_type, size_t count) {
+    if (count == 0) {
+        return SQSOLVER_OK;
+    }
+    if (a == NULL || b == NULL || c == NULL || x1 == NULL || x2 == NULL || result_type == NULL) {
+        return SQSOLVER_ERROR;
+    }
+
+    if (context == NULL || context->num_workers == 0 || count < PARALLEL_MIN_COUNT) {
+        solve_square_equations_soa(a, b, c, x1, x2, result_type, count);
+        return SQSOLVER_OK;
+    }
+
+    pthread_mutex_lock(&context->call_mutex);
+    pthread_mutex_lock(&context->mutex);
+    context->a = a;
+    context->b = b;
+    context->c = c;
+    context->x1 = x1;
+    context->x2 = x2;
+    context->result_type = result_type;
+    context->count = count;
+    context->next_chunk.store(0);
+    context->active_workers = context->num_workers;
+    context->generation++;
+    pthread_cond_broadcast(&context->work_ready);
+    pthread_mutex_unlock(&context->mutex);
+
+    run_chunks(context);
+
+    pthread_mutex_lock(&context->mutex);
+    while (context->active_workers != 0) {
+        pthread_cond_wait(&context->work_done, &context->mutex);
+    }
+    pthread_mutex_unlock(&context->mutex);
+    pthread_mutex_unlock(&context->call_mutex);
+    return SQSOLVER_OK;
+}
@@ -14,10 +14,16 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <float.h>
 #include "solver.h"
 #include "input_output_solver.h"
 #include "error_code.h"
 #include "comparison_with_zero.h"
+#include "int_solver.h"
+#include "dedup_solver.h"
+#include "packed_results.h"
+#include "record_io.h"
+#include "sqsolver.h"
 
 /**
  * @enum TestResult
@@ -154,6 +160,486 @@ enum TestResult run_test(struct Test test, int test_num) {
     return test_result;
 }
 
+/**
+ * @brief         .
+ *
+ * @details
+ *       @ref solve_int_square_equation.   ,
+ *  ,        double.
+ *
+ * @param[in] test    ,   .
+ * @param[in] test_num  .
+ * @return enum TestResult   (TEST_PASSED  TEST_FAILED).
+ */
+enum TestResult run_int_test(struct Test test, int test_num) {
+    IntSquareEquationCoefficient coeffs = { (long long) test.a, (long long) test.b, (long long) test.c };
+    ExactSquareEquationResult exact;
+
+    enum TestResult test_result = TEST_FAILED;
+    if (solve_int_square_equation(coeffs, &exact) == SUCCESS) {
+        test_result = check_roots(&test, &exact.result);
+    }
+
+    if (test_result == TEST_PASSED && exact.is_rational) {
+        if (!is_close((double) exact.x1_exact.num / exact.x1_exact.den, exact.result.x1) ||
+            (exact.result.result_type == TwoRoots &&
+             !is_close((double) exact.x2_exact.num / exact.x2_exact.den, exact.result.x2))) {
+            test_result = TEST_FAILED;
+        }
+    }
+
+    print_test_result(test_num, &test, &exact.result, test_result);
+    return test_result;
+}
+
+/**
+ * @brief         .
+ *
+ * @details
+ *       @ref solve_square_equation_branchless  ,
+ *       ,     0.
+ *
+ * @param[in] test    .
+ * @param[in] test_num  .
+ * @return enum TestResult   (TEST_PASSED  TEST_FAILED).
+ */
+enum TestResult run_branchless_test(struct Test test, int test_num) {
+    SquareEquationCoefficient coeffs = { test.a, test.b, test.c };
+    CompactSquareEquationResult compact = solve_square_equation_branchless(coeffs);
+    SquareEquationResult result = { compact.x1, compact.x2, (RootNumber) compact.result_type };
+
+    enum TestResult test_result = check_roots(&test, &result);
+    if ((result.result_type != OneRoot && result.result_type != TwoRoots && result.x1 != 0) ||
+        (result.result_type != TwoRoots && result.x2 != 0)) {
+        test_result = TEST_FAILED;
+    }
+
+    print_test_result(test_num, &test, &result, test_result);
+    return test_result;
+}
+
+/**
+ * @brief      .
+ *
+ * @details
+ *           @ref solve_square_equations
+ *  @ref solve_square_equations_dedup       .
+ *     ,      .
+ *
+ * @param[in] tests  ,   MAX_BATCH_TESTS.
+ * @param[in] num_tests  .
+ * @param[in] first_test_num   .
+ * @param[in] num_unique       0,    .
+ * @return   .
+ */
+size_t run_batch_tests(const struct Test* tests, size_t num_tests, int first_test_num, size_t num_unique) {
+    const size_t MAX_BATCH_TESTS = 64;
+    SquareEquationCoefficient coeffs[MAX_BATCH_TESTS] = {};
+    SquareEquationResult results[MAX_BATCH_TESTS];
+
+    if (num_tests > MAX_BATCH_TESTS) {
+        num_tests = MAX_BATCH_TESTS;
+    }
+
+    for (size_t i = 0; i < num_tests; ++i) {
+        coeffs[i].a = tests[i].a;
+        coeffs[i].b = tests[i].b;
+        coeffs[i].c = tests[i].c;
+    }
+    size_t failed_tests_counter = 0;
+    if (num_unique > 0) {
+        DedupStats stats = {};
+        solve_square_equations_dedup(coeffs, results, num_tests, &stats);
+        if (stats.num_equations != num_tests || stats.num_unique != num_unique) {
+            printf("    :  %zu  %zu,  %zu\n",
+                   stats.num_unique, stats.num_equations, num_unique);
+            ++failed_tests_counter;
+        }
+    } else {
+        solve_square_equations(coeffs, results, num_tests);
+    }
+
+    for (size_t i = 0; i < num_tests; ++i) {
+        enum TestResult test_result = check_roots(&tests[i], &results[i]);
+        print_test_result(first_test_num + (int) i, &tests[i], &results[i], test_result);
+        if (test_result == TEST_FAILED) {
+            ++failed_tests_counter;
+        }
+    }
+    return failed_tests_counter;
+}
+
+/**
+ * @brief            .
+ *
+ * @param[in] encoding   .
+ * @param[in,out] results  ,   PACKED_BLOCK_SIZE;  .
+ * @param[in] num_results  .
+ * @return    (0  ).
+ */
+size_t round_trip_packed(PackedEncoding encoding, SquareEquationResult* results, size_t num_results) {
+    unsigned char block[PACKED_MAX_BLOCK_BYTES];
+
+    FILE* file = tmpfile();
+    if (file == NULL) {
+        printf("        \n");
+        return 0;
+    }
+    fwrite(block, 1, write_packed_header(&encoding, block), file);
+    fwrite(block, 1, encode_packed_block(&encoding, results, num_results, block), file);
+    rewind(file);
+
+    PackedReader reader = {};
+    size_t count = 0;
+    if (open_packed_reader(&reader, file) != SUCCESS ||
+        read_packed_block(&reader, results, &count) != SUCCESS || count != num_results) {
+        count = 0;
+    }
+    fclose(file);
+    return count;
+}
+
+/**
+ * @brief       .
+ *
+ * @details
+ *        ,    
+ *    ,        
+ *   .
+ *
+ * @param[in] tests  ,   PACKED_BLOCK_SIZE.
+ * @param[in] num_tests  .
+ * @param[in] first_test_num   .
+ * @param[in] encoding   .
+ * @return   .
+ */
+size_t run_packed_tests(const struct Test* tests, size_t num_tests, int first_test_num, PackedEncoding encoding) {
+    SquareEquationCoefficient coeffs[PACKED_BLOCK_SIZE] = {};
+    SquareEquationResult results[PACKED_BLOCK_SIZE];
+
+    if (num_tests > PACKED_BLOCK_SIZE) {
+        num_tests = PACKED_BLOCK_SIZE;
+    }
+
+    for (size_t i = 0; i < num_tests; ++i) {
+        coeffs[i].a = tests[i].a;
+        coeffs[i].b = tests[i].b;
+        coeffs[i].c = tests[i].c;
+    }
+    solve_square_equations(coeffs, results, num_tests);
+    size_t count = round_trip_packed(encoding, results, num_tests);
+
+    size_t failed_tests_counter = 0;
+    for (size_t i = 0; i < num_tests; ++i) {
+        enum TestResult test_result = i < count ? check_roots(&tests[i], &results[i]) : TEST_FAILED;
+        print_test_result(first_test_num + (int) i, &tests[i], &results[i], test_result);
+        if (test_result == TEST_FAILED) {
+            ++failed_tests_counter;
+        }
+    }
+    return failed_tests_counter;
+}
+
+/**
+ * @brief   ,      .
+ *
+ * @param[in] test_num  .
+ * @param[in] description  .
+ * @param[in] passed   .
+ * @return enum TestResult   (TEST_PASSED  TEST_FAILED).
+ */
+enum TestResult print_check_result(int test_num, const char* description, bool passed) {
+    if (passed) {
+        printf("  %d \n", test_num);
+        return TEST_PASSED;
+    }
+    printf("  %d  \n\t%s\n", test_num, description);
+    return TEST_FAILED;
+}
+
+/**
+ * @brief        .
+ *
+ * @details
+ *    2         "%.2f"
+ *  ,   (0.125  -0.125   ,  0.12  -0.12).
+ *  1e-300    float32,      double  .
+ *
+ * @param[in] first_test_num   .
+ * @return   .
+ */
+size_t run_packed_rounding_tests(int first_test_num) {
+    const double FIXED_ROOTS[] = { 0.125, -0.125, 0.375, 2.675, 1.005, -7.5e-3 };
+    const size_t NUM_FIXED_ROOTS = sizeof(FIXED_ROOTS) / sizeof(FIXED_ROOTS[0]);
+    size_t failed_tests_counter = 0;
+
+    SquareEquationResult results[NUM_FIXED_ROOTS] = {};
+    for (size_t i = 0; i < NUM_FIXED_ROOTS; ++i) {
+        results[i] = { FIXED_ROOTS[i], 0, OneRoot };
+    }
+    PackedEncoding fixed32_encoding = { PACKED_ROOTS_FIXED32, 2 };
+    bool passed = round_trip_packed(fixed32_encoding, results, NUM_FIXED_ROOTS) == NUM_FIXED_ROOTS;
+    for (size_t i = 0; passed && i < NUM_FIXED_ROOTS; ++i) {
+        char expected[32] = "";
+        char decoded[32] = "";
+        snprintf(expected, sizeof(expected), "%.2f", FIXED_ROOTS[i]);
+        snprintf(decoded, sizeof(decoded), "%.2f", results[i].x1);
+        passed = strcmp(expected, decoded) == 0;
+    }
+    if (print_check_result(first_test_num, "   2      \"%.2f\"",
+                           passed) == TEST_FAILED) {
+        ++failed_tests_counter;
+    }
+
+    SquareEquationResult tiny_roots[1] = { { 1e-300, -1e-300, TwoRoots } };
+    PackedEncoding float32_encoding = { PACKED_ROOTS_FLOAT32, 0 };
+    passed = round_trip_packed(float32_encoding, tiny_roots, 1) == 1 &&
+             tiny_roots[0].x1 == 1e-300 && tiny_roots[0].x2 == -1e-300;
+    if (print_check_result(first_test_num + 1, ",    float32,   ",
+                           passed) == TEST_FAILED) {
+        ++failed_tests_counter;
+    }
+    return failed_tests_counter;
+}
+
+/**
+ * @brief ,         .
+ *
+ * @details
+ *  1e300 ( 0 1 -1e300)  "%.2f"  304 .
+ *       CSV      
+ *  .        :
+ *     -DBL_MAX.
+ *
+ * @param[in] first_test_num   .
+ * @return   .
+ */
+size_t run_record_tests(int first_test_num) {
+    struct RecordTest {
+        RecordFormat format;               /**<  . */
+        SquareEquationCoefficient coeffts; /**<  . */
+        SquareEquationResult result;       /**<  . */
+        const char* tail_format;           /**<      . */
+        const char* description;           /**<  . */
+    };
+    const struct RecordTest RECORD_TESTS[] = {
+        { RECORD_TEXT, { 0, 1, -1e300 }, { 1e300, 0, OneRoot }, "%.2f\n",
+          "   1e300    " },
+        { RECORD_CSV,  { 0, 1, -1e300 }, { 1e300, 0, OneRoot }, "%.2f,\n",
+          "   1e300   CSV " },
+        { RECORD_TEXT, { -DBL_MAX, -DBL_MAX, -DBL_MAX }, { -DBL_MAX, -DBL_MAX, TwoRoots }, "%.2f\n",
+          "   -DBL_MAX " }
+    };
+    const size_t NUM_RECORD_TESTS = sizeof(RECORD_TESTS) / sizeof(RECORD_TESTS[0]);
+    size_t failed_tests_counter = 0;
+
+    for (size_t i = 0; i < NUM_RECORD_TESTS; ++i) {
+        const struct RecordTest* test = &RECORD_TESTS[i];
+        char record[MAX_RECORD_LENGTH] = "";
+        size_t length = format_solution_record(record, test->format, test->coeffts, test->result);
+
+        char tail[MAX_RECORD_LENGTH] = "";
+        snprintf(tail, sizeof(tail), test->tail_format,
+                 test->result.result_type == TwoRoots ? test->result.x2 : test->result.x1);
+        size_t tail_length = strlen(tail);
+
+        bool passed = length == strlen(record) && length > tail_length &&
+                      strcmp(record + length - tail_length, tail) == 0 &&
+                      strchr(record, '\n') == record + length - 1;
+        if (print_check_result(first_test_num + (int) i, test->description, passed) == TEST_FAILED) {
+            ++failed_tests_counter;
+        }
+    }
+    return failed_tests_counter;
+}
+
+/**
+ * @brief          .
+ *
+ * @details
+ *     @ref solve_small_int_square_equations,   
+ *      @ref solve_int_square_equation.  , 
+ *    +0.0   .
+ *
+ * @param[in] tests     ,   MAX_BATCH_TESTS.
+ * @param[in] num_tests  .
+ * @param[in] first_test_num   .
+ * @return   .
+ */
+size_t run_small_int_tests(const struct Test* tests, size_t num_tests, int first_test_num) {
+    const size_t MAX_BATCH_TESTS = 64;
+    double a[MAX_BATCH_TESTS] = {};
+    double b[MAX_BATCH_TESTS] = {};
+    double c[MAX_BATCH_TESTS] = {};
+    SquareEquationResult results[MAX_BATCH_TESTS];
+
+    if (num_tests > MAX_BATCH_TESTS) {
+        num_tests = MAX_BATCH_TESTS;
+    }
+
+    for (size_t i = 0; i < num_tests; ++i) {
+        a[i] = tests[i].a;
+        b[i] = tests[i].b;
+        c[i] = tests[i].c;
+    }
+    solve_small_int_square_equations(a, b, c, results, num_tests);
+
+    size_t failed_tests_counter = 0;
+    for (size_t i = 0; i < num_tests; ++i) {
+        IntSquareEquationCoefficient coeffs = { (long long) a[i], (long long) b[i], (long long) c[i] };
+        ExactSquareEquationResult exact;
+
+        bool same = solve_int_square_equation(coeffs, &exact) == SUCCESS &&
+                    exact.result.result_type == results[i].result_type;
+        if (same && (results[i].result_type == OneRoot || results[i].result_type == TwoRoots)) {
+            same = memcmp(&exact.result.x1, &results[i].x1, sizeof(double)) == 0;
+        }
+        if (same && results[i].result_type == TwoRoots) {
+            same = memcmp(&exact.result.x2, &results[i].x2, sizeof(double)) == 0;
+        }
+
+        enum TestResult test_result = same ? check_roots(&tests[i], &results[i]) : TEST_FAILED;
+        print_test_result(first_test_num + (int) i, &tests[i], &results[i], test_result);
+        if (test_result == TEST_FAILED) {
+            ++failed_tests_counter;
+        }
+    }
+    return failed_tests_counter;
+}
+
+/**
+ * @brief     C API   sqsolver_solve.
+ *
+ * @param[in] a   a.
+ * @param[in] b   b.
+ * @param[in] c   c.
+ * @param[in] x1     .
+ * @param[in] x2     .
+ * @param[in] result_type     .
+ * @param[in] count  .
+ * @return true,     .
+ */
+bool same_as_single_solves(const double* a, const double* b, const double* c,
+                           const double* x1, const double* x2, const unsigned char* result_type, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        sqsolver_result result = {};
+        if (sqsolver_solve(a[i], b[i], c[i], &result) != SQSOLVER_OK ||
+            result.result_type != result_type[i] ||
+            memcmp(&result.x1, &x1[i], sizeof(double)) != 0 ||
+            memcmp(&result.x2, &x2[i], sizeof(double)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief   C API .
+ *
+ * @details
+ *      @ref sqsolver_solve     .
+ *    SQSOLVER_TEST_BATCH_SIZE  (    
+ *   )  @ref sqsolver_solve_batch     
+ *     4 .   ,   sqsolver.cpp  
+ *   (4 * 4096 ),        
+ * sqsolver_solve.        NULL.
+ *
+ * @param[in] tests  .
+ * @param[in] num_tests  .
+ * @param[in] first_test_num   .
+ * @return   .
+ */
+size_t run_sqsolver_tests(const struct Test* tests, size_t num_tests, int first_test_num) {
+    const size_t SQSOLVER_TEST_BATCH_SIZE = 10 * 4096 + 123;
+    const int NUM_CONTEXT_CALLS = 3;
+    size_t failed_tests_counter = 0;
+    int test_num = first_test_num;
+
+    for (size_t i = 0; i < num_tests; ++i) {
+        sqsolver_result solution = {};
+        int status = sqsolver_solve(tests[i].a, tests[i].b, tests[i].c, &solution);
+        SquareEquationResult result = { solution.x1, solution.x2, (RootNumber) solution.result_type };
+
+        enum TestResult test_result = status == SQSOLVER_OK ? check_roots(&tests[i], &result) : TEST_FAILED;
+        print_test_result(test_num++, &tests[i], &result, test_result);
+        if (test_result == TEST_FAILED) {
+            ++failed_tests_counter;
+        }
+    }
+
+    size_t count = SQSOLVER_TEST_BATCH_SIZE;
+    double* a = (double*) calloc(count, sizeof(double));
+    double* b = (double*) calloc(count, sizeof(double));
+    double* c = (double*) calloc(count, sizeof(double));
+    double* x1 = (double*) calloc(count, sizeof(double));
+    double* x2 = (double*) calloc(count, sizeof(double));
+    unsigned char* result_type = (unsigned char*) calloc(count, sizeof(unsigned char));
+
+    if (a != NULL && b != NULL && c != NULL && x1 != NULL && x2 != NULL && result_type != NULL) {
+        for (size_t i = 0; i < count; ++i) {
+            if (i % 3 == 0) {
+                a[i] = tests[i % num_tests].a;
+                b[i] = tests[i % num_tests].b;
+                c[i] = tests[i % num_tests].c;
+            } else {
+                a[i] = (double) (i % 7) - 3;
+                b[i] = (double) (i % 11) * 0.5 - 2;
+                c[i] = (double) ((i * 7919) % 1000) / 8 - 60;
+            }
+        }
+
+        bool passed = sqsolver_solve_batch(NULL, a, b, c, x1, x2, result_type, count) == SQSOLVER_OK &&
+                      same_as_single_solves(a, b, c, x1, x2, result_type, count);
+        if (print_check_result(test_num++, "      sqsolver_solve", passed) == TEST_FAILED) {
+            ++failed_tests_counter;
+        }
+
+        sqsolver_context* context = sqsolver_create(4);
+        for (int call = 0; call < NUM_CONTEXT_CALLS; ++call) {
+            memset(x1, 0xff, count * sizeof(double));
+            memset(x2, 0xff, count * sizeof(double));
+            memset(result_type, 0xff, count * sizeof(unsigned char));
+
+            passed = context != NULL &&
+                     sqsolver_solve_batch(context, a, b, c, x1, x2, result_type, count) == SQSOLVER_OK &&
+                     same_as_single_solves(a, b, c, x1, x2, result_type, count);
+            if (print_check_result(test_num++, "    4     sqsolver_solve",
+                                   passed) == TEST_FAILED) {
+                ++failed_tests_counter;
+            }
+        }
+        sqsolver_destroy(context);
+    } else {
+        printf("      C API\n");
+        failed_tests_counter += 1 + NUM_CONTEXT_CALLS;
+        test_num += 1 + NUM_CONTEXT_CALLS;
+    }
+
+    double coeff = 1;
+    double root = 0;
+    unsigned char type = 0;
+    bool errors_reported = sqsolver_solve(1, 2, 1, NULL) == SQSOLVER_ERROR &&
+                           sqsolver_solve_batch(NULL, NULL, &coeff, &coeff, &root, &root, &type, 1) == SQSOLVER_ERROR &&
+                           sqsolver_solve_batch(NULL, &coeff, NULL, &coeff, &root, &root, &type, 1) == SQSOLVER_ERROR &&
+                           sqsolver_solve_batch(NULL, &coeff, &coeff, NULL, &root, &root, &type, 1) == SQSOLVER_ERROR &&
+                           sqsolver_solve_batch(NULL, &coeff, &coeff, &coeff, NULL, &root, &type, 1) == SQSOLVER_ERROR &&
+                           sqsolver_solve_batch(NULL, &coeff, &coeff, &coeff, &root, NULL, &type, 1) == SQSOLVER_ERROR &&
+                           sqsolver_solve_batch(NULL, &coeff, &coeff, &coeff, &root, &root, NULL, 1) == SQSOLVER_ERROR &&
+                           sqsolver_solve_batch(NULL, NULL, NULL, NULL, NULL, NULL, NULL, 0) == SQSOLVER_OK;
+    sqsolver_destroy(NULL);
+    if (print_check_result(test_num++, "     NULL", errors_reported) == TEST_FAILED) {
+        ++failed_tests_counter;
+    }
+
+    free(a);
+    free(b);
+    free(c);
+    free(x1);
+    free(x2);
+    free(result_type);
+    return failed_tests_counter;
+}
+
 /**
  * @brief       .
  *
@@ -186,5 +672,84 @@ void run_tests() {
         }
     }
 
+    struct Test int_test_data[] = {
+        {NoRoots,   0,         0,                 5,                 0,                  0},
+        {NoRoots,   2,         6,                14,                 0,                  0},
+        {OneRoot,   0,        -3,                 1,       1.0 / 3.0,                  0},
+        {OneRoot,   9,       -54,                81,                 3,                  0},
+        {TwoRoots,  6,        -5,                 1,             0.5,          1.0 / 3.0},
+        {TwoRoots,  1,         0,                -2,     sqrt(2.0),         -sqrt(2.0)},
+        {TwoRoots,  3, 328000001,  8965333388000000, -328000000.0 / 6,   -328000002.0 / 6},
+        {InfRoots,  0,         0,                 0,                 0,                  0}
+    };
+
+    const size_t NUM_INT_TESTS = sizeof(int_test_data) / sizeof(int_test_data[0]);
+
+    for (size_t i = 0; i < NUM_INT_TESTS; ++i) {
+        if (run_int_test(int_test_data[i], NUM_TESTS + i) == TEST_FAILED) {
+            ++failed_tests_counter;
+        }
+    }
+
+    failed_tests_counter += run_batch_tests(int_test_data, NUM_INT_TESTS, NUM_TESTS + NUM_INT_TESTS, 0);
+
+    struct Test branchless_test_data[] = {
+        {NoRoots,   0,    0,    5,    0,    0},
+        {NoRoots,   2,    6,   14,    0,    0},
+        {OneRoot,   0,  -14,    7,  0.5,    0},
+        {OneRoot,   9,  -54,   81,    3,    0},
+        {OneRoot,   7,    0,    0,    0,    0},
+        {TwoRoots,  5,  -20, -105,    7,   -3},
+        {TwoRoots, 12,    6,    0,    0, -0.5},
+        {InfRoots,  0,    0,    0,    0,    0}
+    };
+
+    const size_t NUM_BRANCHLESS_TESTS = sizeof(branchless_test_data) / sizeof(branchless_test_data[0]);
+
+    for (size_t i = 0; i < NUM_BRANCHLESS_TESTS; ++i) {
+        if (run_branchless_test(branchless_test_data[i], NUM_TESTS + 2 * NUM_INT_TESTS + i) == TEST_FAILED) {
+            ++failed_tests_counter;
+        }
+    }
+
+    struct Test dedup_test_data[3 * NUM_INT_TESTS] = {};
+    for (size_t i = 0; i < 3 * NUM_INT_TESTS; ++i) {
+        dedup_test_data[i] = int_test_data[(i * 5) % NUM_INT_TESTS];
+    }
+
+    failed_tests_counter += run_batch_tests(dedup_test_data, 3 * NUM_INT_TESTS,
+                                            NUM_TESTS + 2 * NUM_INT_TESTS + NUM_BRANCHLESS_TESTS, NUM_INT_TESTS);
+
+    int packed_test_num = (int) (NUM_TESTS + 5 * NUM_INT_TESTS + NUM_BRANCHLESS_TESTS);
+    PackedEncoding float32_encoding = { PACKED_ROOTS_FLOAT32, 0 };
+    PackedEncoding fixed32_encoding = { PACKED_ROOTS_FIXED32, 6 };
+
+    failed_tests_counter += run_packed_tests(branchless_test_data, NUM_BRANCHLESS_TESTS,
+                                             packed_test_num, float32_encoding);
+    failed_tests_counter += run_packed_tests(branchless_test_data, NUM_BRANCHLESS_TESTS,
+                                             packed_test_num + (int) NUM_BRANCHLESS_TESTS, fixed32_encoding);
+
+    failed_tests_counter += run_packed_rounding_tests(packed_test_num + 2 * (int) NUM_BRANCHLESS_TESTS);
+
+    failed_tests_counter += run_record_tests(packed_test_num + 2 * (int) NUM_BRANCHLESS_TESTS + 2);
+
+    struct Test zero_root_test_data[] = {
+        {OneRoot,   0,         5,                 0,                 0,                  0},
+        {OneRoot,   0,        -5,                 0,                 0,                  0},
+        {OneRoot,  -3,         0,                 0,                 0,                  0},
+        {OneRoot,   3,         0,                 0,                 0,                  0},
+        {TwoRoots, -1,         3,                 0,                 0,                  3},
+        {TwoRoots,  1,        -3,                 0,                 3,                  0},
+        {TwoRoots, -2,        -4,                 0,                -2,                  0},
+        {TwoRoots,  2,         4,                 0,                 0,                 -2},
+    };
+    const size_t NUM_ZERO_ROOT_TESTS = sizeof(zero_root_test_data) / sizeof(zero_root_test_data[0]);
+    int small_int_test_num = packed_test_num + 2 * (int) NUM_BRANCHLESS_TESTS + 5;
+
+    failed_tests_counter += run_small_int_tests(zero_root_test_data, NUM_ZERO_ROOT_TESTS, small_int_test_num);
+
+    failed_tests_counter += run_sqsolver_tests(int_test_data, NUM_INT_TESTS,
+                                               small_int_test_num + (int) NUM_ZERO_ROOT_TESTS);
+
     printf("\n .   : %d\n", failed_tests_counter);
 }